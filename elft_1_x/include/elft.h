@@ -258,6 +258,36 @@ namespace ELFT
 		    const uint8_t bpp,
 		    const std::vector<std::byte> &pixels);
 
+		/**
+		 * @brief
+		 * Image constructor that takes ownership of pixel data.
+		 *
+		 * @param identifier
+		 * An identifier for this image. Used to link Image to
+		 * TemplateData and Correspondence.
+		 * @param width
+		 * Width of the image in pixels.
+		 * @param height
+		 * Height of the image in pixels.
+		 * @param ppi
+		 * Resolution of the image in pixels per inch.
+		 * @param bpc
+		 * Number of bits used by each color component (8 or 16).
+		 * @param bpp
+		 * Number of bits comprising a single pixel.
+		 * @param pixels
+		 * Image data, as described in the copying constructor. Moved
+		 * into #pixels, so large images are not copied.
+		 */
+		Image(
+		    const uint8_t identifier,
+		    const uint16_t width,
+		    const uint16_t height,
+		    const uint16_t ppi,
+		    const uint8_t bpc,
+		    const uint8_t bpp,
+		    std::vector<std::byte> &&pixels);
+
 		/**
 		 * An identifier for this image. Used to link Image to EFS,
 		 * TemplateData, and Correspondence.
@@ -1098,7 +1128,7 @@ namespace ELFT
 	/** API minor version number. */
 	uint16_t API_MINOR_VERSION{0};
 	/** API patch version number. */
-	uint16_t API_PATCH_VERSION{1};
+	uint16_t API_PATCH_VERSION{2};
 	#endif /* NIST_EXTERN_API_VERSION */
 }
 
@@ -8,6 +8,8 @@
  * about its quality, reliability, or any other characteristic.
  */
 
+#include <utility>
+
 #include <elft.h>
 
 ELFT::ExtractionInterface::ExtractionInterface() = default;
@@ -51,6 +53,25 @@ ELFT::Image::Image(
 
 }
 
+ELFT::Image::Image(
+    const uint8_t identifier,
+    const uint16_t width,
+    const uint16_t height,
+    const uint16_t ppi,
+    const uint8_t bpc,
+    const uint8_t bpp,
+    std::vector<std::byte> &&pixels) :
+    identifier{identifier},
+    width{width},
+    height{height},
+    ppi{ppi},
+    bpc{bpc},
+    bpp{bpp},
+    pixels{std::move(pixels)}
+{
+
+}
+
 ELFT::ReturnStatus::operator bool()
     const
     noexcept
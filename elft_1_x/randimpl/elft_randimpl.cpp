@@ -8,8 +8,21 @@
  * about its quality, reliability, or any other characteristic.
  */
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstring>
 #include <exception>
 #include <fstream>
+#include <system_error>
+#include <utility>
 
 #include <elft_randimpl.h>
 
@@ -31,80 +44,1381 @@ ELFT::RandomImplementation::Util::loadConfiguration(
 	if (!file)
 		throw std::runtime_error{"Couldn't read from configuration"};
 
+	/* Thread count is optional, defaulting as described in ThreadPool */
+	const auto threadsPath = configurationDirectory /
+	    RandomImplementation::Constants::threadsFileName;
+	if (std::filesystem::exists(threadsPath)) {
+		std::ifstream threadsFile{threadsPath};
+		unsigned int numThreads{};
+		threadsFile >> numThreads;
+		if (!threadsFile || (numThreads == 0))
+			throw std::runtime_error{"Couldn't read number of "
+			    "threads from configuration"};
+		params.numThreads = numThreads;
+	}
+
 	return (params);
 }
 
-std::vector<ELFT::RandomImplementation::Tmpl>
-ELFT::RandomImplementation::Util::parseTemplate(
-    const std::filesystem::path &pathToTemplate)
+uint64_t
+ELFT::RandomImplementation::Util::hash(
+    const void *data,
+    const std::size_t size)
 {
-	std::ifstream file{pathToTemplate,
-	    std::ifstream::ate | std::ifstream::binary};
-	if (!file)
+	uint64_t h{0xCBF29CE484222325};
+	const auto bytes = static_cast<const unsigned char *>(data);
+	for (std::size_t i{}; i < size; ++i) {
+		h ^= bytes[i];
+		h *= 0x00000100000001B3;
+	}
+	return (h);
+}
+
+uint64_t
+ELFT::RandomImplementation::Util::deriveSeed(
+    const uint64_t seed,
+    const uint64_t key)
+{
+	/* One round of SplitMix64 so that nearby keys diverge */
+	return (SplitMix64{seed ^ (key * 0x9E3779B97F4A7C15)}());
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::SplitMix64::SplitMix64(
+    const uint64_t seed) :
+    state{seed}
+{
+
+}
+
+ELFT::RandomImplementation::SplitMix64::result_type
+ELFT::RandomImplementation::SplitMix64::operator()()
+{
+	uint64_t z{this->state += 0x9E3779B97F4A7C15};
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+	return (z ^ (z >> 31));
+}
+
+unsigned int
+ELFT::RandomImplementation::Util::positionBit(
+    const FrictionRidgeGeneralizedPosition frgp)
+{
+	/* Positions are numbered 0-38 and 81-86 */
+	const auto value = static_cast<unsigned int>(frgp);
+	if (value <= 38)
+		return (value);
+	if ((value >= 81) && (value <= 86))
+		return (value - 42);
+	return (63);
+}
+
+uint64_t
+ELFT::RandomImplementation::Util::positionMask(
+    const TemplateView &templateData)
+{
+	uint64_t mask{};
+	for (const auto &t : templateData)
+		mask |= (uint64_t{1} << positionBit(t.frgp));
+	return (mask);
+}
+
+uint64_t
+ELFT::RandomImplementation::Util::compatiblePositions(
+    const FrictionRidgeGeneralizedPosition frgp)
+{
+	using FRGP = FrictionRidgeGeneralizedPosition;
+	const auto bits = [](const std::initializer_list<FRGP> positions) {
+		uint64_t mask{};
+		for (const auto position : positions)
+			mask |= (uint64_t{1} << positionBit(position));
+		return (mask);
+	};
+
+	/* References whose position could include anything */
+	const uint64_t anyFinger{bits({FRGP::UnknownFinger,
+	    FRGP::UnknownFrictionRidge, FRGP::EJIOrTip})};
+	const uint64_t anyPalm{bits({FRGP::UnknownPalm,
+	    FRGP::UnknownFrictionRidge})};
+
+	const uint64_t rightPalm{anyPalm | bits({FRGP::RightFullPalm,
+	    FRGP::RightWritersPalm, FRGP::RightLowerPalm, FRGP::RightUpperPalm,
+	    FRGP::RightPalmOther, FRGP::RightInterdigital, FRGP::RightThenar,
+	    FRGP::RightHypothenar, FRGP::RightGrasp, FRGP::RightCarpalDeltaArea,
+	    FRGP::RightFullPalmAndWritersPalm, FRGP::RightWristBracelet})};
+	const uint64_t leftPalm{anyPalm | bits({FRGP::LeftFullPalm,
+	    FRGP::LeftWritersPalm, FRGP::LeftLowerPalm, FRGP::LeftUpperPalm,
+	    FRGP::LeftPalmOther, FRGP::LeftInterdigital, FRGP::LeftThenar,
+	    FRGP::LeftHypothenar, FRGP::LeftGrasp, FRGP::LeftCarpalDeltaArea,
+	    FRGP::LeftFullPalmAndWritersPalm, FRGP::LeftWristBracelet})};
+
+	switch (frgp) {
+	case FRGP::UnknownFinger:
+		[[fallthrough]];
+	case FRGP::EJIOrTip:
+		return (anyFinger | bits({FRGP::RightThumb, FRGP::RightIndex,
+		    FRGP::RightMiddle, FRGP::RightRing, FRGP::RightLittle,
+		    FRGP::LeftThumb, FRGP::LeftIndex, FRGP::LeftMiddle,
+		    FRGP::LeftRing, FRGP::LeftLittle, FRGP::RightExtraDigit,
+		    FRGP::LeftExtraDigit, FRGP::RightFour, FRGP::LeftFour,
+		    FRGP::RightAndLeftThumbs}));
+
+	case FRGP::RightThumb:
+		[[fallthrough]];
+	case FRGP::RightIndex:
+		[[fallthrough]];
+	case FRGP::RightMiddle:
+		[[fallthrough]];
+	case FRGP::RightRing:
+		[[fallthrough]];
+	case FRGP::RightLittle:
+		[[fallthrough]];
+	case FRGP::LeftThumb:
+		[[fallthrough]];
+	case FRGP::LeftIndex:
+		[[fallthrough]];
+	case FRGP::LeftMiddle:
+		[[fallthrough]];
+	case FRGP::LeftRing:
+		[[fallthrough]];
+	case FRGP::LeftLittle:
+		return (anyFinger | bits({frgp, *slapContaining(frgp)}));
+	case FRGP::RightExtraDigit:
+		return (anyFinger | bits({frgp, FRGP::RightFour}));
+	case FRGP::LeftExtraDigit:
+		return (anyFinger | bits({frgp, FRGP::LeftFour}));
+
+	case FRGP::RightFour:
+		return (anyFinger | bits({frgp, FRGP::RightIndex,
+		    FRGP::RightMiddle, FRGP::RightRing, FRGP::RightLittle,
+		    FRGP::RightExtraDigit}));
+	case FRGP::LeftFour:
+		return (anyFinger | bits({frgp, FRGP::LeftIndex,
+		    FRGP::LeftMiddle, FRGP::LeftRing, FRGP::LeftLittle,
+		    FRGP::LeftExtraDigit}));
+	case FRGP::RightAndLeftThumbs:
+		return (anyFinger | bits({frgp, FRGP::RightThumb,
+		    FRGP::LeftThumb}));
+
+	case FRGP::UnknownPalm:
+		return (rightPalm | leftPalm);
+	case FRGP::RightFullPalm:
+		[[fallthrough]];
+	case FRGP::RightWritersPalm:
+		[[fallthrough]];
+	case FRGP::RightLowerPalm:
+		[[fallthrough]];
+	case FRGP::RightUpperPalm:
+		[[fallthrough]];
+	case FRGP::RightPalmOther:
+		[[fallthrough]];
+	case FRGP::RightInterdigital:
+		[[fallthrough]];
+	case FRGP::RightThenar:
+		[[fallthrough]];
+	case FRGP::RightHypothenar:
+		[[fallthrough]];
+	case FRGP::RightGrasp:
+		[[fallthrough]];
+	case FRGP::RightCarpalDeltaArea:
+		[[fallthrough]];
+	case FRGP::RightFullPalmAndWritersPalm:
+		[[fallthrough]];
+	case FRGP::RightWristBracelet:
+		return (rightPalm);
+	case FRGP::LeftFullPalm:
+		[[fallthrough]];
+	case FRGP::LeftWritersPalm:
+		[[fallthrough]];
+	case FRGP::LeftLowerPalm:
+		[[fallthrough]];
+	case FRGP::LeftUpperPalm:
+		[[fallthrough]];
+	case FRGP::LeftPalmOther:
+		[[fallthrough]];
+	case FRGP::LeftInterdigital:
+		[[fallthrough]];
+	case FRGP::LeftThenar:
+		[[fallthrough]];
+	case FRGP::LeftHypothenar:
+		[[fallthrough]];
+	case FRGP::LeftGrasp:
+		[[fallthrough]];
+	case FRGP::LeftCarpalDeltaArea:
+		[[fallthrough]];
+	case FRGP::LeftFullPalmAndWritersPalm:
+		[[fallthrough]];
+	case FRGP::LeftWristBracelet:
+		return (leftPalm);
+
+	case FRGP::UnknownFrictionRidge:
+		break;
+	}
+
+	return (Constants::allPositions);
+}
+
+std::optional<ELFT::FrictionRidgeGeneralizedPosition>
+ELFT::RandomImplementation::Util::slapContaining(
+    const FrictionRidgeGeneralizedPosition frgp)
+{
+	switch (frgp) {
+	case FrictionRidgeGeneralizedPosition::RightIndex:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::RightMiddle:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::RightRing:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::RightLittle:
+		return (FrictionRidgeGeneralizedPosition::RightFour);
+	case FrictionRidgeGeneralizedPosition::LeftIndex:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::LeftMiddle:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::LeftRing:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::LeftLittle:
+		return (FrictionRidgeGeneralizedPosition::LeftFour);
+	case FrictionRidgeGeneralizedPosition::RightThumb:
+		[[fallthrough]];
+	case FrictionRidgeGeneralizedPosition::LeftThumb:
+		return (FrictionRidgeGeneralizedPosition::RightAndLeftThumbs);
+	default:
 		return {};
-	file.unsetf(std::ifstream::skipws);
+	}
+}
+
+ELFT::ReturnStatus
+ELFT::RandomImplementation::Util::syncDirectory(
+    const std::filesystem::path &directory)
+{
+	const auto name = (directory.empty() ? std::filesystem::path{"."} :
+	    directory);
+	const int fd = ::open(name.c_str(), O_RDONLY | O_DIRECTORY |
+	    O_CLOEXEC);
+	if ((fd == -1) || (::fsync(fd) != 0)) {
+		const auto message = std::system_error(errno,
+		    std::system_category()).code().message();
+		if (fd != -1)
+			::close(fd);
+		return {ReturnStatus::Result::Failure, "Could not sync " +
+		    name.string() + " (" + message + ')'};
+	}
+	::close(fd);
+
+	return {};
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::TemplateView::TemplateView(
+    const TemplateBuffer templateData)
+{
+	const auto name = reinterpret_cast<const char *>(templateData.data);
+	this->id = {name, ::strnlen(name, templateData.size)};
+	this->last = templateData.data + templateData.size;
+
+	/* Without a terminated identifier, there are no native templates */
+	this->first = this->last;
+	if (this->id.size() < templateData.size)
+		this->first = templateData.data + this->id.size() + 1;
+}
+
+ELFT::RandomImplementation::TemplateView::TemplateView(
+    const std::vector<std::byte> &templateData) :
+    TemplateView(TemplateBuffer{templateData.data(), templateData.size()})
+{
+
+}
+
+std::string_view
+ELFT::RandomImplementation::TemplateView::identifier()
+    const
+    noexcept
+{
+	return (this->id);
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator
+ELFT::RandomImplementation::TemplateView::begin()
+    const
+{
+	return (Iterator(this->first, this->last));
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator
+ELFT::RandomImplementation::TemplateView::end()
+    const
+{
+	return (Iterator(this->last, this->last));
+}
+
+std::size_t
+ELFT::RandomImplementation::TemplateView::size()
+    const
+{
+	return (static_cast<std::size_t>(std::distance(this->begin(),
+	    this->end())));
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator::Iterator(
+    const std::byte *position,
+    const std::byte *end) :
+    position{position},
+    end{end}
+{
+	this->decode();
+}
+
+void
+ELFT::RandomImplementation::TemplateView::Iterator::decode()
+{
+	/* Each native template has a three byte header */
+	static const std::ptrdiff_t headerSize{3};
+	if ((this->end - this->position) < headerSize) {
+		this->position = this->end;
+		return;
+	}
+
+	this->current.inputIdentifier = static_cast<uint8_t>(
+	    this->position[0]);
+	this->current.frgp = static_cast<FrictionRidgeGeneralizedPosition>(
+	    this->position[1]);
+	this->current.payload = {this->position + headerSize,
+	    static_cast<uint8_t>(this->position[2])};
+	if ((this->end - this->current.payload.data) <
+	    static_cast<std::ptrdiff_t>(this->current.payload.size))
+		this->position = this->end;
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator::reference
+ELFT::RandomImplementation::TemplateView::Iterator::operator*()
+    const
+    noexcept
+{
+	return (this->current);
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator::pointer
+ELFT::RandomImplementation::TemplateView::Iterator::operator->()
+    const
+    noexcept
+{
+	return (&this->current);
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator&
+ELFT::RandomImplementation::TemplateView::Iterator::operator++()
+{
+	this->position = this->current.payload.data +
+	    this->current.payload.size;
+	this->decode();
+	return (*this);
+}
+
+ELFT::RandomImplementation::TemplateView::Iterator
+ELFT::RandomImplementation::TemplateView::Iterator::operator++(int)
+{
+	auto previous = *this;
+	++(*this);
+	return (previous);
+}
+
+bool
+ELFT::RandomImplementation::TemplateView::Iterator::operator==(
+    const Iterator &rhs)
+    const
+    noexcept
+{
+	return (this->position == rhs.position);
+}
+
+bool
+ELFT::RandomImplementation::TemplateView::Iterator::operator!=(
+    const Iterator &rhs)
+    const
+    noexcept
+{
+	return (!(*this == rhs));
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::MappedFile::MappedFile() = default;
+
+ELFT::RandomImplementation::MappedFile::MappedFile(
+    const std::filesystem::path &path)
+{
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd == -1)
+		throw std::runtime_error{"Could not open " + path.string() +
+		    " (" + std::system_error(errno, std::system_category()).
+		    code().message() + ')'};
+
+	struct stat sb{};
+	if (::fstat(fd, &sb) != 0) {
+		const auto error = errno;
+		::close(fd);
+		throw std::runtime_error{"Could not stat " + path.string() +
+		    " (" + std::system_error(error, std::system_category()).
+		    code().message() + ')'};
+	}
+
+	/* mmap() refuses zero-length mappings */
+	if (sb.st_size > 0) {
+		this->length = static_cast<std::size_t>(sb.st_size);
+		this->address = ::mmap(nullptr, this->length, PROT_READ,
+		    MAP_SHARED, fd, 0);
+		if (this->address == MAP_FAILED) {
+			const auto error = errno;
+			this->address = nullptr;
+			this->length = 0;
+			::close(fd);
+			throw std::runtime_error{"Could not map " +
+			    path.string() + " (" + std::system_error(error,
+			    std::system_category()).code().message() + ')'};
+		}
+	}
+
+	/* Mapping remains valid after closing the descriptor */
+	::close(fd);
+}
+
+ELFT::RandomImplementation::MappedFile::MappedFile(
+    MappedFile &&rhs)
+    noexcept :
+    address{std::exchange(rhs.address, nullptr)},
+    length{std::exchange(rhs.length, 0)}
+{
 
-	const auto size = file.tellg();
-	if (size == -1)
+}
+
+ELFT::RandomImplementation::MappedFile&
+ELFT::RandomImplementation::MappedFile::operator=(
+    MappedFile &&rhs)
+    noexcept
+{
+	if (this != &rhs) {
+		if (this->address != nullptr)
+			::munmap(this->address, this->length);
+		this->address = std::exchange(rhs.address, nullptr);
+		this->length = std::exchange(rhs.length, 0);
+	}
+
+	return (*this);
+}
+
+ELFT::RandomImplementation::MappedFile::~MappedFile()
+{
+	if (this->address != nullptr)
+		::munmap(this->address, this->length);
+}
+
+const std::byte*
+ELFT::RandomImplementation::MappedFile::data()
+    const
+    noexcept
+{
+	return (static_cast<const std::byte *>(this->address));
+}
+
+std::size_t
+ELFT::RandomImplementation::MappedFile::size()
+    const
+    noexcept
+{
+	return (this->length);
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::TopCandidates::TopCandidates(
+    const std::size_t capacity) :
+    capacity{capacity}
+{
+	this->heap.reserve(capacity);
+}
+
+bool
+ELFT::RandomImplementation::TopCandidates::ranksAhead(
+    const Entry &lhs,
+    const Entry &rhs)
+{
+	if (lhs.similarity != rhs.similarity)
+		return (lhs.similarity > rhs.similarity);
+	return (lhs.position < rhs.position);
+}
+
+void
+ELFT::RandomImplementation::TopCandidates::push(
+    const Entry &entry)
+{
+	if (this->heap.size() < this->capacity) {
+		this->heap.push_back(entry);
+		std::push_heap(this->heap.begin(), this->heap.end(),
+		    ranksAhead);
+		return;
+	}
+
+	/* Replace the lowest-ranked entry only if this one outranks it */
+	if ((this->capacity == 0) || !ranksAhead(entry, this->heap.front()))
+		return;
+	std::pop_heap(this->heap.begin(), this->heap.end(), ranksAhead);
+	this->heap.back() = entry;
+	std::push_heap(this->heap.begin(), this->heap.end(), ranksAhead);
+}
+
+void
+ELFT::RandomImplementation::TopCandidates::merge(
+    const TopCandidates &other)
+{
+	for (const auto &entry : other.heap)
+		this->push(entry);
+}
+
+std::vector<ELFT::RandomImplementation::TopCandidates::Entry>
+ELFT::RandomImplementation::TopCandidates::sorted()
+    const
+{
+	auto entries = this->heap;
+	std::sort_heap(entries.begin(), entries.end(), ranksAhead);
+	return (entries);
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::ThreadPool::ThreadPool(
+    const std::optional<unsigned int> numThreads) :
+    numThreads{numThreads},
+    creator{::getpid()}
+{
+	/* Registered once, for the pools of all implementations */
+	static std::once_flag registered{};
+	std::call_once(registered, []() {
+		if (::pthread_atfork(lockAll, unlockAll, unlockAll) != 0)
+			throw std::runtime_error{"Could not register fork "
+			    "handlers"};
+	});
+
+	std::lock_guard<std::mutex> lock{poolsMutex()};
+	pools().insert(this);
+}
+
+ELFT::RandomImplementation::ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock{poolsMutex()};
+		pools().erase(this);
+	}
+
+	/* Threads started by a parent process don't exist in this one */
+	if (this->owner != ::getpid()) {
+		this->abandon();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping = true;
+	}
+	this->available->notify_all();
+
+	for (auto &t : this->threads)
+		t.join();
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::abandon()
+{
+	if (!this->threads.empty())
+		static_cast<void>(new std::vector<std::thread>(
+		    std::move(this->threads)));
+	this->threads.clear();
+	static_cast<void>(this->available.release());
+	this->available = std::make_unique<std::condition_variable>();
+	this->queue.clear();
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::lockAll()
+{
+	/* Released by unlockAll(), in both the parent and the child */
+	poolsMutex().lock();
+	for (auto *pool : pools())
+		pool->mutex.lock();
+}
+
+std::mutex&
+ELFT::RandomImplementation::ThreadPool::poolsMutex()
+{
+	static std::mutex mutex{};
+	return (mutex);
+}
+
+std::set<ELFT::RandomImplementation::ThreadPool*>&
+ELFT::RandomImplementation::ThreadPool::pools()
+{
+	static std::set<ThreadPool*> pools{};
+	return (pools);
+}
+
+unsigned int
+ELFT::RandomImplementation::ThreadPool::size()
+    const
+    noexcept
+{
+	if (this->numThreads)
+		return (std::max(1u, *this->numThreads));
+
+	/* Processes forked from the creator already run in parallel */
+	if (::getpid() != this->creator)
+		return (1);
+	return (std::max(1u, std::thread::hardware_concurrency()));
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::start()
+{
+	std::lock_guard<std::mutex> lock{this->mutex};
+	if (!this->threads.empty() && (this->owner == ::getpid()))
+		return;
+
+	/*
+	 * Implementations may be instantiated before fork(). Worker threads
+	 * are not copied into the child, so abandon them and start over.
+	 */
+	if (this->owner != ::getpid())
+		this->abandon();
+
+	this->owner = ::getpid();
+	const auto numThreads = this->size();
+	this->threads.reserve(numThreads - 1);
+	for (unsigned int i{1}; i < numThreads; ++i)
+		this->threads.emplace_back(&ThreadPool::work, this);
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::unlockAll()
+{
+	for (auto *pool : pools())
+		pool->mutex.unlock();
+	poolsMutex().unlock();
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::work()
+{
+	for (;;) {
+		std::function<void()> task{};
+		{
+			std::unique_lock<std::mutex> lock{this->mutex};
+			this->available->wait(lock, [this]() {
+				return (this->stopping || !this->queue.empty());
+			});
+			if (this->stopping)
+				return;
+
+			task = std::move(this->queue.front());
+			this->queue.pop_front();
+		}
+		task();
+	}
+}
+
+void
+ELFT::RandomImplementation::ThreadPool::parallelFor(
+    const std::size_t count,
+    const std::function<void(std::size_t)> &task)
+{
+	const auto numHelpers = std::min<std::size_t>(this->size(), count) -
+	    (count > 0 ? 1 : 0);
+	if (numHelpers == 0) {
+		for (std::size_t i{}; i < count; ++i)
+			task(i);
+		return;
+	}
+	this->start();
+
+	/* Helpers and the caller pull indices until none remain */
+	std::atomic<std::size_t> next{0};
+	std::exception_ptr error{};
+	std::mutex jobMutex{};
+	std::condition_variable finished{};
+	std::size_t runningHelpers{numHelpers};
+
+	const auto drain = [&]() {
+		for (auto i = next++; i < count; i = next++) {
+			try {
+				task(i);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock{jobMutex};
+				if (!error)
+					error = std::current_exception();
+				next = count;
+			}
+		}
+	};
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		for (std::size_t i{}; i < numHelpers; ++i)
+			this->queue.emplace_back([&]() {
+				drain();
+
+				std::lock_guard<std::mutex> jobLock{jobMutex};
+				if (--runningHelpers == 0)
+					finished.notify_one();
+			});
+	}
+	this->available->notify_all();
+
+	drain();
+
+	/* Helpers reference this stack frame, so wait for all of them */
+	std::unique_lock<std::mutex> lock{jobMutex};
+	finished.wait(lock, [&]() { return (runningHelpers == 0); });
+	if (error)
+		std::rethrow_exception(error);
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::BloomFilter::BloomFilter(
+    const std::size_t capacity)
+{
+	/* Ten bits per element gives ~1% false positives with seven hashes */
+	std::size_t numWords{1};
+	while ((numWords * 64) < (capacity * 10))
+		numWords *= 2;
+	this->bits.assign(numWords, 0);
+}
+
+void
+ELFT::RandomImplementation::BloomFilter::add(
+    const uint64_t hash)
+{
+	/* Double hashing: bit i is (h1 + i * h2) */
+	const uint64_t mask{(this->bits.size() * 64) - 1};
+	const uint64_t h2{SplitMix64{hash}() | 1};
+	uint64_t bit{hash};
+	for (unsigned int i{}; i < numHashes; ++i, bit += h2)
+		this->bits[(bit & mask) / 64] |= (uint64_t{1} << (bit % 64));
+}
+
+bool
+ELFT::RandomImplementation::BloomFilter::mayContain(
+    const uint64_t hash)
+    const
+    noexcept
+{
+	const uint64_t mask{(this->bits.size() * 64) - 1};
+	const uint64_t h2{SplitMix64{hash}() | 1};
+	uint64_t bit{hash};
+	for (unsigned int i{}; i < numHashes; ++i, bit += h2)
+		if ((this->bits[(bit & mask) / 64] &
+		    (uint64_t{1} << (bit % 64))) == 0)
+			return (false);
+	return (true);
+}
+
+/******************************************************************************/
+
+std::optional<std::size_t>
+ELFT::RandomImplementation::IdentifierIndex::locate(
+    const std::string_view identifier,
+    const uint64_t hash)
+    const
+{
+	if (this->slots.empty() || !this->filter.mayContain(hash))
 		return {};
 
-	std::vector<std::byte> templateData{};
-	templateData.resize(static_cast<std::vector<std::byte>::size_type>(
-	    size));
-	file.seekg(std::ifstream::beg);
-	file.read(reinterpret_cast<char *>(templateData.data()), size);
+	/* Erased slots don't end a probe sequence, empty ones do */
+	const std::size_t mask{this->slots.size() - 1};
+	for (std::size_t i{static_cast<std::size_t>(hash) & mask};;
+	    i = (i + 1) & mask) {
+		const auto &slot = this->slots[i];
+		if (!slot.occupied && !slot.erased)
+			return {};
+		if (slot.occupied && (slot.hash == hash) &&
+		    (slot.identifier == identifier))
+			return (i);
+	}
+}
+
+void
+ELFT::RandomImplementation::IdentifierIndex::rehash(
+    const std::size_t capacity)
+{
+	/* Keep load (including erased slots) at or below one half */
+	std::size_t numSlots{16};
+	while (numSlots < (capacity * 2))
+		numSlots *= 2;
+
+	auto previous = std::exchange(this->slots,
+	    std::vector<Slot>(numSlots));
+	this->filter = BloomFilter(numSlots / 2);
+	this->used = this->count;
+
+	const std::size_t mask{numSlots - 1};
+	for (const auto &slot : previous) {
+		if (!slot.occupied)
+			continue;
+		auto i = static_cast<std::size_t>(slot.hash) & mask;
+		while (this->slots[i].occupied)
+			i = (i + 1) & mask;
+		this->slots[i] = slot;
+		this->filter.add(slot.hash);
+	}
+}
+
+void
+ELFT::RandomImplementation::IdentifierIndex::insert(
+    const std::string_view identifier,
+    const uint64_t position)
+{
+	const auto hash = Util::hash(identifier.data(), identifier.size());
+	if (const auto existing = this->locate(identifier, hash)) {
+		this->slots[*existing].identifier = identifier;
+		this->slots[*existing].position = position;
+		return;
+	}
+
+	if (((this->used + 1) * 2) > this->slots.size())
+		this->rehash(this->count + 1);
+
+	/* Reuse the first erased slot in the probe sequence */
+	const std::size_t mask{this->slots.size() - 1};
+	auto i = static_cast<std::size_t>(hash) & mask;
+	while (this->slots[i].occupied)
+		i = (i + 1) & mask;
+	if (!this->slots[i].erased)
+		++this->used;
+
+	this->slots[i] = {identifier, hash, position, true, false};
+	this->filter.add(hash);
+	++this->count;
+}
+
+bool
+ELFT::RandomImplementation::IdentifierIndex::erase(
+    const std::string_view identifier)
+{
+	const auto i = this->locate(identifier, Util::hash(identifier.data(),
+	    identifier.size()));
+	if (!i)
+		return (false);
+
+	/* Bits stay set in the filter until the next rehash() */
+	this->slots[*i].occupied = false;
+	this->slots[*i].erased = true;
+	--this->count;
+	return (true);
+}
+
+std::optional<uint64_t>
+ELFT::RandomImplementation::IdentifierIndex::find(
+    const std::string_view identifier)
+    const
+{
+	const auto i = this->locate(identifier, Util::hash(identifier.data(),
+	    identifier.size()));
+	if (!i)
+		return {};
+	return (this->slots[*i].position);
+}
+
+void
+ELFT::RandomImplementation::IdentifierIndex::clear()
+{
+	this->slots.clear();
+	this->filter = BloomFilter();
+	this->count = 0;
+	this->used = 0;
+}
+
+std::size_t
+ELFT::RandomImplementation::IdentifierIndex::size()
+    const
+    noexcept
+{
+	return (this->count);
+}
+
+/******************************************************************************/
 
-	return (parseTemplate(templateData));
+ELFT::RandomImplementation::ReferenceDatabase::ReferenceDatabase() = default;
+
+ELFT::RandomImplementation::ReferenceDatabase::ReferenceDatabase(
+    const std::filesystem::path &path)
+{
+	if (!std::filesystem::exists(path))
+		return;
+
+	this->file = MappedFile(path);
+
+	DatabaseHeader header{};
+	if (this->file.size() < sizeof(header))
+		throw std::runtime_error{path.string() + " is too small to be "
+		    "a reference database"};
+	std::memcpy(&header, this->file.data(), sizeof(header));
+
+	if (Constants::databaseMagic != std::string_view(header.magic,
+	    sizeof(header.magic)))
+		throw std::runtime_error{path.string() + " is not a "
+		    "reference database"};
+	if (header.version != Constants::databaseVersion)
+		throw std::runtime_error{path.string() + " is reference "
+		    "database version " + std::to_string(header.version) +
+		    ", expected " + std::to_string(
+		    Constants::databaseVersion)};
+	if (header.count > ((this->file.size() - sizeof(header)) /
+	    sizeof(DatabaseEntry)))
+		throw std::runtime_error{path.string() + " is truncated"};
+
+	this->count = header.count;
 }
 
-std::vector<ELFT::RandomImplementation::Tmpl>
-ELFT::RandomImplementation::Util::parseTemplate(
-    const std::vector<std::byte> &templateData)
+uint64_t
+ELFT::RandomImplementation::ReferenceDatabase::size()
+    const
+    noexcept
 {
-	std::vector<Tmpl> templates{};
-	auto it = templateData.cbegin();
+	return (this->count);
+}
 
-	/* First thing in template is string name. Read until null terminator */
-	std::string candidateIdentifier{};
-	while ((it != templateData.cend()) && (static_cast<char>(*it) != '\0'))
-		candidateIdentifier += (static_cast<char>(*it++));
-	++it;
+ELFT::RandomImplementation::DatabaseEntry
+ELFT::RandomImplementation::ReferenceDatabase::entry(
+    const uint64_t position)
+    const
+{
+	if (position >= this->count)
+		throw std::out_of_range{"Reference position " +
+		    std::to_string(position) + " >= " +
+		    std::to_string(this->count)};
+
+	DatabaseEntry entry{};
+	std::memcpy(&entry, this->file.data() + sizeof(DatabaseHeader) +
+	    (position * sizeof(DatabaseEntry)), sizeof(entry));
+	if ((entry.offset > this->file.size()) ||
+	    (entry.size > (this->file.size() - entry.offset)))
+		throw std::runtime_error{"Reference position " +
+		    std::to_string(position) + " is outside of the database"};
+
+	return (entry);
+}
 
-	do {
-		Tmpl t{};
-		t.candidateIdentifier = candidateIdentifier;
-		t.inputIdentifier = static_cast<uint8_t>(*it++);
-		t.frgp = static_cast<FrictionRidgeGeneralizedPosition>(*it++);
-		t.size = static_cast<uint8_t>(*it++);
-		templates.push_back(t);
-		std::advance(it, t.size);
-	} while (it != templateData.cend());
+ELFT::RandomImplementation::TemplateBuffer
+ELFT::RandomImplementation::ReferenceDatabase::at(
+    const uint64_t position)
+    const
+{
+	const auto entry = this->entry(position);
+	return {this->file.data() + entry.offset,
+	    static_cast<std::size_t>(entry.size)};
+}
 
-	return (templates);
+uint64_t
+ELFT::RandomImplementation::ReferenceDatabase::positions(
+    const uint64_t position)
+    const
+{
+	return (this->entry(position).positions);
 }
 
 ELFT::ReturnStatus
-ELFT::RandomImplementation::Util::writeTemplate(
-    const std::filesystem::path &directory,
-    const std::vector<std::byte> &templateData,
-    const bool truncate)
-{
-	const auto identifier = Util::parseTemplate(templateData).front().
-	    candidateIdentifier;
-
-	std::ofstream::openmode mode = std::ofstream::out |
-	    std::ofstream::binary;
-	if (truncate)
-		mode |= std::ofstream::trunc;
-	std::ofstream file{directory / identifier, mode};
-	if (!file)
-		return {ReturnStatus::Result::Failure, "Unable to create "
-		    "template identifier '" + identifier + "'"};
+ELFT::RandomImplementation::ReferenceDatabase::write(
+    const std::filesystem::path &path,
+    std::vector<TemplateBuffer> templates,
+    ThreadPool &pool,
+    const uint64_t maxSize)
+{
+	/* Identifiers are found once, not on every comparison */
+	struct Named
+	{
+		std::string_view identifier{};
+		TemplateBuffer buffer{};
+		uint64_t positions{};
+	};
+	const auto byIdentifier = [](const Named &lhs, const Named &rhs) {
+		return (lhs.identifier < rhs.identifier);
+	};
+	std::vector<Named> named(templates.size());
+	pool.parallelFor(templates.size(), [&](const std::size_t i) {
+		const TemplateView view{templates[i]};
+		named[i] = {view.identifier(), templates[i],
+		    Util::positionMask(view)};
+	});
+
+	/* Sort partitions in parallel, then merge them pairwise */
+	const std::size_t numParts{std::max<std::size_t>(1,
+	    std::min<std::size_t>(pool.size(), named.size()))};
+	std::vector<std::size_t> bounds(numParts + 1);
+	for (std::size_t i{}; i <= numParts; ++i)
+		bounds[i] = (named.size() * i) / numParts;
+	pool.parallelFor(numParts, [&](const std::size_t i) {
+		std::stable_sort(named.begin() + static_cast<std::ptrdiff_t>(
+		    bounds[i]), named.begin() + static_cast<std::ptrdiff_t>(
+		    bounds[i + 1]), byIdentifier);
+	});
+	for (std::size_t width{1}; width < numParts; width *= 2) {
+		pool.parallelFor((numParts + (2 * width) - 1) / (2 * width),
+		    [&](const std::size_t pair) {
+			const auto first = pair * 2 * width;
+			const auto middle = std::min(first + width, numParts);
+			const auto last = std::min(first + (2 * width), numParts);
+			std::inplace_merge(named.begin() +
+			    static_cast<std::ptrdiff_t>(bounds[first]),
+			    named.begin() + static_cast<std::ptrdiff_t>(
+			    bounds[middle]), named.begin() +
+			    static_cast<std::ptrdiff_t>(bounds[last]),
+			    byIdentifier);
+		});
+	}
+
+	/* Keep only the last of any duplicates */
+	const auto last = std::unique(named.rbegin(), named.rend(),
+	    [](const Named &lhs, const Named &rhs) {
+		return (lhs.identifier == rhs.identifier);
+	    });
+	named.erase(named.begin(), last.base());
+
+	DatabaseHeader header{};
+	std::memcpy(header.magic, Constants::databaseMagic.data(),
+	    sizeof(header.magic));
+	header.version = Constants::databaseVersion;
+	header.count = named.size();
+
+	/* Exact layout is known before anything is written */
+	std::vector<DatabaseEntry> entries{};
+	entries.reserve(named.size());
+	uint64_t offset{sizeof(header) + (named.size() *
+	    sizeof(DatabaseEntry))};
+	for (const auto &t : named) {
+		entries.push_back({offset, t.buffer.size, t.positions});
+		offset += t.buffer.size;
+	}
+	const uint64_t fileSize{offset};
+	if (fileSize > maxSize)
+		return {ReturnStatus::Result::Failure, "Reference database "
+		    "requires " + std::to_string(fileSize) + "b, but only " +
+		    std::to_string(maxSize) + "b may be used"};
+
+	/* Write beside the destination and rename, so readers never see a
+	 * partially written database */
+	auto tempPath = path;
+	tempPath += ".tmp";
+	const int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC |
+	    O_CLOEXEC, 0644);
+	if (fd == -1)
+		return {ReturnStatus::Result::Failure, "Unable to create " +
+		    tempPath.string() + " (" + std::system_error(errno,
+		    std::system_category()).code().message() + ')'};
+
+	const auto writeAt = [&](const void *data, const uint64_t size,
+	    uint64_t position) {
+		auto bytes = static_cast<const std::byte *>(data);
+		for (uint64_t remaining{size}; remaining > 0;) {
+			const auto written = ::pwrite(fd, bytes,
+			    static_cast<std::size_t>(remaining),
+			    static_cast<off_t>(position));
+			if (written <= 0)
+				throw std::runtime_error{"Unable to write to " +
+				    tempPath.string() + " (" + std::system_error(
+				    errno, std::system_category()).code().
+				    message() + ')'};
+			bytes += written;
+			position += static_cast<uint64_t>(written);
+			remaining -= static_cast<uint64_t>(written);
+		}
+	};
+
+	try {
+		/* Reserve all space up front, failing early if unavailable */
+		if ((fileSize > 0) && (::posix_fallocate(fd, 0,
+		    static_cast<off_t>(fileSize)) != 0))
+			throw std::runtime_error{"Unable to allocate " +
+			    std::to_string(fileSize) + "b for " +
+			    tempPath.string()};
+
+		writeAt(&header, sizeof(header), 0);
+		writeAt(entries.data(), entries.size() * sizeof(DatabaseEntry),
+		    sizeof(header));
+
+		/* Templates in a shard are contiguous in the file */
+		const std::size_t numShards{static_cast<std::size_t>(
+		    (named.size() + Constants::writeShardSize - 1) /
+		    Constants::writeShardSize)};
+		pool.parallelFor(numShards, [&](const std::size_t shard) {
+			const std::size_t first{static_cast<std::size_t>(
+			    shard * Constants::writeShardSize)};
+			const std::size_t end{std::min(named.size(), first +
+			    static_cast<std::size_t>(
+			    Constants::writeShardSize))};
+
+			std::vector<std::byte> buffer{};
+			buffer.reserve(static_cast<std::size_t>(
+			    entries[end - 1].offset + entries[end - 1].size -
+			    entries[first].offset));
+			for (std::size_t i{first}; i < end; ++i)
+				buffer.insert(buffer.end(), named[i].buffer.data,
+				    named[i].buffer.data + named[i].buffer.size);
+			writeAt(buffer.data(), buffer.size(),
+			    entries[first].offset);
+		});
+		/* Contents must be durable before the rename can be */
+		if (::fdatasync(fd) != 0)
+			throw std::runtime_error{"Unable to sync " +
+			    tempPath.string() + " (" + std::system_error(errno,
+			    std::system_category()).code().message() + ')'};
+	} catch (const std::exception &e) {
+		::close(fd);
+		std::error_code ignored{};
+		std::filesystem::remove(tempPath, ignored);
+		return {ReturnStatus::Result::Failure, e.what()};
+	}
+	if (::close(fd) != 0)
+		return {ReturnStatus::Result::Failure, "Unable to write to " +
+		    tempPath.string()};
+
+	std::error_code error{};
+	std::filesystem::rename(tempPath, path, error);
+	if (error)
+		return {ReturnStatus::Result::Failure, "Unable to rename " +
+		    tempPath.string() + " (" + error.message() + ')'};
+
+	return (Util::syncDirectory(path.parent_path()));
+}
+
+/******************************************************************************/
+
+ELFT::RandomImplementation::Journal::Journal(
+    const std::filesystem::path &path) :
+    path{path}
+{
+
+}
+
+ELFT::RandomImplementation::Journal::~Journal()
+{
+	this->close();
+}
+
+void
+ELFT::RandomImplementation::Journal::close()
+{
+	if (this->fd != -1) {
+		::close(this->fd);
+		this->fd = -1;
+	}
+}
+
+uint64_t
+ELFT::RandomImplementation::Journal::checksum(
+    const JournalRecord &record,
+    const std::byte *payload)
+{
+	return (Util::deriveSeed(Util::hash(payload,
+	    static_cast<std::size_t>(record.size)),
+	    (uint64_t{record.operation} << 32) ^ record.size));
+}
+
+ELFT::ReturnStatus
+ELFT::RandomImplementation::Journal::append(
+    const JournalOperation operation,
+    const TemplateBuffer payload)
+{
+	if (this->fd == -1) {
+		const bool created{!std::filesystem::exists(this->path)};
+		this->fd = ::open(this->path.c_str(), O_WRONLY | O_APPEND |
+		    O_CREAT | O_CLOEXEC, 0644);
+		if (this->fd == -1)
+			return {ReturnStatus::Result::Failure, "Could not open " +
+			    this->path.string() + " (" + std::system_error(errno,
+			    std::system_category()).code().message() + ')'};
+
+		/*
+		 * Records are lost with the file if its name is. An existing
+		 * journal may end with a record torn by a crash, which would
+		 * hide the records appended after it.
+		 */
+		const auto rs = created ? Util::syncDirectory(
+		    this->path.parent_path()) : truncateTorn(this->fd,
+		    this->path);
+		if (!rs) {
+			this->close();
+			return (rs);
+		}
+	}
+
+	JournalRecord record{};
+	record.operation = static_cast<uint32_t>(operation);
+	record.size = payload.size;
+	record.checksum = checksum(record, payload.data);
+
+	struct stat sb{};
+	if (::fstat(this->fd, &sb) != 0)
+		return {ReturnStatus::Result::Failure, "Could not stat " +
+		    this->path.string() + " (" + std::system_error(errno,
+		    std::system_category()).code().message() + ')'};
+
+	/* Header and payload in one write, appended sequentially */
+	std::vector<std::byte> buffer(sizeof(record) + payload.size);
+	std::memcpy(buffer.data(), &record, sizeof(record));
+	if (payload.size > 0)
+		std::memcpy(buffer.data() + sizeof(record), payload.data,
+		    payload.size);
+
+	/* Acknowledged modifications must survive a crash */
+	const auto written = ::write(this->fd, buffer.data(), buffer.size());
+	if ((written != static_cast<ssize_t>(buffer.size())) ||
+	    (::fdatasync(this->fd) != 0)) {
+		/* Later records must not follow a torn one */
+		if (::ftruncate(this->fd, sb.st_size) != 0)
+			this->close();
+		return {ReturnStatus::Result::Failure, "Could not append to " +
+		    this->path.string()};
+	}
+
+	return {};
+}
+
+uint64_t
+ELFT::RandomImplementation::Journal::scan(
+    const MappedFile &file,
+    const std::function<void(JournalOperation, TemplateBuffer)> *apply)
+{
+	uint64_t offset{};
+	while ((file.size() - offset) >= sizeof(JournalRecord)) {
+		JournalRecord record{};
+		std::memcpy(&record, file.data() + offset, sizeof(record));
+		const auto payload = file.data() + offset + sizeof(record);
+
+		/* Anything invalid was torn by a crash, and ends the journal */
+		if (record.size > (file.size() - offset - sizeof(record)))
+			break;
+		if ((record.operation != static_cast<uint32_t>(
+		    JournalOperation::Insert)) && (record.operation !=
+		    static_cast<uint32_t>(JournalOperation::Remove)))
+			break;
+		if (record.checksum != checksum(record, payload))
+			break;
+
+		if (apply != nullptr)
+			(*apply)(static_cast<JournalOperation>(record.operation),
+			    {payload, static_cast<std::size_t>(record.size)});
+		offset += sizeof(record) + record.size;
+	}
+
+	return (offset);
+}
+
+uint64_t
+ELFT::RandomImplementation::Journal::replay(
+    const std::filesystem::path &path,
+    const std::function<void(JournalOperation, TemplateBuffer)> &apply)
+{
+	if (!std::filesystem::exists(path))
+		return (0);
+
+	uint64_t count{};
+	const std::function<void(JournalOperation, TemplateBuffer)> counted =
+	    [&](const JournalOperation operation, const TemplateBuffer payload) {
+		apply(operation, payload);
+		++count;
+	    };
+
+	/* The database may be read-only, so a torn record is left alone */
+	const MappedFile file(path);
+	scan(file, &counted);
+
+	return (count);
+}
+
+ELFT::ReturnStatus
+ELFT::RandomImplementation::Journal::truncateTorn(
+    const int fd,
+    const std::filesystem::path &path)
+{
+	uint64_t length{};
+	try {
+		const MappedFile file(path);
+		length = scan(file, nullptr);
+		if (length == file.size())
+			return {};
+	} catch (const std::exception &e) {
+		return {ReturnStatus::Result::Failure, e.what()};
+	}
+
+	if ((::ftruncate(fd, static_cast<off_t>(length)) != 0) ||
+	    (::fdatasync(fd) != 0))
+		return {ReturnStatus::Result::Failure, "Could not truncate " +
+		    path.string() + " (" + std::system_error(errno,
+		    std::system_category()).code().message() + ')'};
+
+	return {};
+}
 
-	if (!file.write(reinterpret_cast<const char *>(templateData.data()),
-	    static_cast<std::streamsize>(templateData.size())))
-		return {ReturnStatus::Result::Failure, "Unable to write to "
-		    "identifier '" + identifier + "'"};
+ELFT::ReturnStatus
+ELFT::RandomImplementation::Journal::rotate(
+    const std::filesystem::path &source,
+    const std::filesystem::path &destination)
+{
+	if (!std::filesystem::exists(source))
+		return {};
+
+	std::error_code error{};
+	if (!std::filesystem::exists(destination)) {
+		std::filesystem::rename(source, destination, error);
+		if (error)
+			return {ReturnStatus::Result::Failure, "Unable to rename " +
+			    source.string() + " (" + error.message() + ')'};
+		return {};
+	}
+
+	/* A previous compaction failed, so append to its journal */
+	try {
+		const MappedFile file(source);
+		const auto length = scan(file, nullptr);
+
+		const int fd = ::open(destination.c_str(), O_WRONLY | O_APPEND |
+		    O_CLOEXEC);
+		if (fd == -1)
+			return {ReturnStatus::Result::Failure, "Could not open " +
+			    destination.string() + " (" + std::system_error(
+			    errno, std::system_category()).code().message() +
+			    ')'};
+
+		/* Records copied after a torn one would never be replayed */
+		const auto rs = truncateTorn(fd, destination);
+		if (!rs) {
+			::close(fd);
+			return (rs);
+		}
+
+		uint64_t offset{};
+		while (offset < length) {
+			const auto written = ::write(fd, file.data() + offset,
+			    static_cast<std::size_t>(length - offset));
+			if (written <= 0)
+				break;
+			offset += static_cast<uint64_t>(written);
+		}
+		/* Copies must be durable before the source is removed */
+		if ((offset == length) && (::fdatasync(fd) != 0))
+			offset = 0;
+		::close(fd);
+		if (offset != length)
+			return {ReturnStatus::Result::Failure, "Could not append "
+			    "to " + destination.string()};
+	} catch (const std::exception &e) {
+		return {ReturnStatus::Result::Failure, e.what()};
+	}
+
+	std::filesystem::remove(source, error);
+	if (error)
+		return {ReturnStatus::Result::Failure, "Unable to remove " +
+		    source.string() + " (" + error.message() + ')'};
 
 	return {};
 }
@@ -114,8 +1428,9 @@ ELFT::RandomImplementation::Util::writeTemplate(
 ELFT::RandomImplementation::ExtractionImplementation::ExtractionImplementation(
     const std::filesystem::path &configurationDirectory) :
     ELFT::ExtractionInterface(),
-    rng{RandomImplementation::Util::loadConfiguration(
-        configurationDirectory).seed}
+    configuration{RandomImplementation::Util::loadConfiguration(
+        configurationDirectory)},
+    pool{configuration.numThreads}
 {
 
 }
@@ -163,6 +1478,11 @@ ELFT::RandomImplementation::ExtractionImplementation::createTemplate(
         std::optional<ELFT::Image>, std::optional<ELFT::EFS>>> &samples)
     const
 {
+	/* Same identifier and type always produce the same template */
+	SplitMix64 rng{Util::deriveSeed(Util::deriveSeed(
+	    this->configuration.seed, static_cast<uint64_t>(templateType)),
+	    Util::hash(identifier.data(), identifier.size()))};
+
 	std::vector<std::byte> combinedTemplate{};
 	for (const auto &c : identifier)
 		combinedTemplate.push_back(static_cast<std::byte>(c));
@@ -196,7 +1516,7 @@ ELFT::RandomImplementation::ExtractionImplementation::createTemplate(
 
 		/* Generare a random amount of 0s and record */
 		const uint8_t templateSize{static_cast<uint8_t>(
-		    this->rng() % UINT8_MAX)};
+		    rng() % UINT8_MAX)};
 		combinedTemplate.push_back(static_cast<std::byte>(
 		    templateSize));
 		combinedTemplate.insert(combinedTemplate.end(),
@@ -212,35 +1532,37 @@ ELFT::RandomImplementation::ExtractionImplementation::extractTemplateData(
     const ELFT::CreateTemplateResult &templateResult)
     const
 {
-	const auto templates = Util::parseTemplate(templateResult.data);
+	SplitMix64 rng{Util::deriveSeed(this->configuration.seed,
+	    Util::hash(templateResult.data.data(),
+	    templateResult.data.size()))};
 
 	std::vector<TemplateData> tds{};
-	for (const auto &t : templates) {
+	for (const auto &t : TemplateView(templateResult.data)) {
 		TemplateData td{};
 		td.inputIdentifier = t.inputIdentifier;
 
 		/* Make up a couple features */
 		EFS efs{};
 		if (templateType == TemplateType::Probe) {
-			efs.orientation = (this->rng() % 180);
+			efs.orientation = (rng() % 180);
 			if (*efs.orientation % 2)
 				(*efs.orientation) = static_cast<int16_t>(
 				    efs.orientation.value() * -1);
 		}
 
 		const uint8_t numMinutia{static_cast<uint8_t>(
-		    this->rng() % UINT8_MAX)};
+		    rng() % UINT8_MAX)};
 		if (numMinutia > 0) {
 			efs.minutia = std::vector<Minutia>{};
 			efs.minutia->reserve(numMinutia);
 			for (uint8_t i{}; i < numMinutia; ++i) {
 				Minutia m{};
 				m.coordinate.x = static_cast<uint16_t>(
-				    this->rng() % 1000);
+				    rng() % 1000);
 				m.coordinate.y = static_cast<uint16_t>(
-				    this->rng() % 1000);
+				    rng() % 1000);
 				m.theta = static_cast<uint16_t>(
-				    this->rng() % 360);
+				    rng() % 360);
 
 				efs.minutia->push_back(m);
 			}
@@ -260,25 +1582,34 @@ ELFT::RandomImplementation::ExtractionImplementation::createReferenceDatabase(
     const uint64_t maxSize)
     const
 {
-	/* First, do a rough check that we have enough space */
-	static const uint8_t maxFingerSize{UINT8_MAX};
-	static const uint8_t estimatedNumImagesPerSubject{20};
-	if ((maxFingerSize * estimatedNumImagesPerSubject *
-	    referenceTemplates.size()) > maxSize)
-		return {ReturnStatus::Result::Failure, "Given a maximum "
-		    "template size of " + std::to_string(maxFingerSize) + "b "
-		    "and an estimated number of fingers per subject of " +
-		    std::to_string(estimatedNumImagesPerSubject) + ", " +
-		    std::to_string(maxSize) + "b does not seem to be enough."};
-
-	for (const auto &combinedTemplate : referenceTemplates) {
-		const auto rs = Util::writeTemplate(databaseDirectory,
-		    combinedTemplate);
-		if (!rs)
-			return (rs);
+	std::vector<TemplateBuffer> templates{};
+	templates.reserve(referenceTemplates.size());
+	for (const auto &combinedTemplate : referenceTemplates)
+		templates.push_back({combinedTemplate.data(),
+		    combinedTemplate.size()});
+
+	/* Size is checked exactly before anything is written */
+	const auto rs = ReferenceDatabase::write(databaseDirectory /
+	    Constants::databaseFileName, std::move(templates), this->pool,
+	    maxSize);
+	if (!rs)
+		return (rs);
+
+	/*
+	 * Journals from a previous database would modify this one. They are
+	 * kept until it is replaced, so a failure leaves it as it was.
+	 */
+	for (const auto &name : {Constants::journalFileName,
+	    Constants::compactingJournalFileName}) {
+		std::error_code error{};
+		std::filesystem::remove(databaseDirectory / name, error);
+		if (error)
+			return {ReturnStatus::Result::Failure, "Unable to remove " +
+			    (databaseDirectory / name).string() + " (" +
+			    error.message() + ')'};
 	}
 
-	return {};
+	return (Util::syncDirectory(databaseDirectory));
 }
 
 std::shared_ptr<ELFT::ExtractionInterface>
@@ -297,10 +1628,187 @@ ELFT::RandomImplementation::SearchImplementation::SearchImplementation(
     const std::filesystem::path &databaseDirectory) :
     ELFT::SearchInterface(),
     databaseDirectory{databaseDirectory},
-    rng{RandomImplementation::Util::loadConfiguration(
-        configurationDirectory).seed}
+    configuration{RandomImplementation::Util::loadConfiguration(
+        configurationDirectory)},
+    references{load(databaseDirectory)},
+    journal{databaseDirectory / Constants::journalFileName},
+    pool{configuration.numThreads}
+{
+
+}
+
+ELFT::RandomImplementation::SearchImplementation::~SearchImplementation()
+{
+	this->reapCompactor();
+}
+
+ELFT::RandomImplementation::SearchImplementation::References
+ELFT::RandomImplementation::SearchImplementation::load(
+    const std::filesystem::path &databaseDirectory)
+{
+	References references{};
+	references.database = ReferenceDatabase(databaseDirectory /
+	    Constants::databaseFileName);
+	references.superseded.assign(references.database.size(), false);
+	for (uint64_t i{}; i < references.database.size(); ++i) {
+		references.index.insert(TemplateView(references.database.at(
+		    i)).identifier(), i);
+		references.track(i, references.database.positions(i));
+	}
+
+	/*
+	 * Records being compacted precede those in the active journal.
+	 * Either may already be in the database after a crash, but
+	 * applying a record twice has no further effect.
+	 */
+	const auto apply = [&references](const JournalOperation operation,
+	    const TemplateBuffer payload) {
+		references.apply(operation, payload);
+	};
+	references.journalRecords = Journal::replay(databaseDirectory /
+	    Constants::compactingJournalFileName, apply);
+	references.journalRecords += Journal::replay(databaseDirectory /
+	    Constants::journalFileName, apply);
+
+	return (references);
+}
+
+void
+ELFT::RandomImplementation::SearchImplementation::References::apply(
+    const JournalOperation operation,
+    const TemplateBuffer payload)
+{
+	switch (operation) {
+	case JournalOperation::Insert: {
+		const uint64_t position{this->superseded.size()};
+		this->journalTemplates.emplace_back(payload.data,
+		    payload.data + payload.size);
+		const auto identifier = TemplateView(
+		    this->journalTemplates.back()).identifier();
+
+		if (const auto previous = this->index.find(identifier))
+			this->superseded[*previous] = true;
+		this->superseded.push_back(false);
+		this->index.insert(identifier, position);
+		this->track(position, Util::positionMask(TemplateView(
+		    this->journalTemplates.back())));
+		break;
+	}
+	case JournalOperation::Remove: {
+		const std::string_view identifier{reinterpret_cast<
+		    const char *>(payload.data), payload.size};
+		if (const auto previous = this->index.find(identifier)) {
+			this->superseded[*previous] = true;
+			this->index.erase(identifier);
+		}
+		break;
+	}
+	}
+}
+
+void
+ELFT::RandomImplementation::SearchImplementation::References::track(
+    const uint64_t position,
+    const uint64_t positions)
+{
+	this->positionMasks.push_back(positions);
+	for (unsigned int bit{}; bit < this->buckets.size(); ++bit)
+		if (positions & (uint64_t{1} << bit))
+			this->buckets[bit].push_back(position);
+}
+
+ELFT::RandomImplementation::TemplateBuffer
+ELFT::RandomImplementation::SearchImplementation::References::reference(
+    const uint64_t position)
+    const
+{
+	if (position < this->database.size())
+		return (this->database.at(position));
+
+	const auto &t = this->journalTemplates.at(static_cast<std::size_t>(
+	    position - this->database.size()));
+	return {t.data(), t.size()};
+}
+
+void
+ELFT::RandomImplementation::SearchImplementation::scheduleCompaction()
+{
+	/* Compaction inherited from a parent process never finishes here */
+	if (this->compacting && (this->compactorOwner != ::getpid()))
+		this->reapCompactor();
+
+	if (this->compacting || (this->references.journalRecords < std::max(
+	    Constants::journalCompactionMinimum,
+	    this->references.database.size() / 4)))
+		return;
+	this->reapCompactor();
+
+	/* New modifications go to a new journal while this one is folded in */
+	this->journal.close();
+	if (!Journal::rotate(this->databaseDirectory /
+	    Constants::journalFileName, this->databaseDirectory /
+	    Constants::compactingJournalFileName))
+		return;
+	this->references.journalRecords = 0;
+
+	/* Overlay and mapping stay alive until compact() reloads */
+	std::vector<TemplateBuffer> templates{};
+	templates.reserve(this->references.index.size());
+	for (uint64_t i{}; i < this->references.superseded.size(); ++i)
+		if (!this->references.superseded[i])
+			templates.push_back(this->references.reference(i));
+
+	this->compacting = true;
+	this->compactorOwner = ::getpid();
+	this->compactor = std::thread(&SearchImplementation::compact, this,
+	    std::move(templates));
+}
+
+void
+ELFT::RandomImplementation::SearchImplementation::compact(
+    std::vector<TemplateBuffer> templates)
+{
+	/*
+	 * On failure, the journals are folded in on the next attempt. On
+	 * success, the new database is on stable storage, so its journal is
+	 * no longer needed once the new database is loaded.
+	 */
+	const auto rs = ReferenceDatabase::write(this->databaseDirectory /
+	    Constants::databaseFileName, std::move(templates), this->pool);
+	if (rs) {
+		std::unique_lock<std::shared_mutex> lock{this->mutex};
+		try {
+			/* Searches keep the current state until this succeeds */
+			auto loaded = load(this->databaseDirectory);
+
+			std::error_code error{};
+			std::filesystem::remove(this->databaseDirectory /
+			    Constants::compactingJournalFileName, error);
+			/* Then only the active journal remains to compact */
+			if (!error)
+				loaded.journalRecords = this->references.
+				    journalRecords;
+			this->references = std::move(loaded);
+		} catch (const std::exception&) {
+			/* Journals are intact and will be replayed later */
+		}
+	}
+
+	this->compacting = false;
+}
+
+void
+ELFT::RandomImplementation::SearchImplementation::reapCompactor()
 {
+	if (!this->compactor.joinable())
+		return;
 
+	if (this->compactorOwner == ::getpid()) {
+		this->compactor.join();
+		return;
+	}
+	static_cast<void>(new std::thread(std::move(this->compactor)));
+	this->compacting = false;
 }
 
 std::optional<ELFT::ProductIdentifier>
@@ -322,8 +1830,9 @@ ELFT::RandomImplementation::SearchImplementation::exists(
     const std::string &identifier)
     const
 {
-	return {{},
-	    std::filesystem::exists(this->databaseDirectory / identifier)};
+	std::shared_lock<std::shared_mutex> lock{this->mutex};
+	return {ReturnStatus{}, this->references.index.find(identifier).
+	    has_value()};
 }
 
 ELFT::ReturnStatus
@@ -331,35 +1840,42 @@ ELFT::RandomImplementation::SearchImplementation::insert(
     const std::string &identifier,
     const std::vector<std::byte> &referenceTemplate)
 {
-	auto [rs, truncate] = this->exists(identifier);
+	const TemplateBuffer buffer{referenceTemplate.data(),
+	    referenceTemplate.size()};
+	if (TemplateView(buffer).identifier() != identifier)
+		return {ReturnStatus::Result::Failure, "Template does not "
+		    "represent '" + identifier + "'"};
+
+	std::unique_lock<std::shared_mutex> lock{this->mutex};
+	const auto rs = this->journal.append(JournalOperation::Insert, buffer);
 	if (!rs)
-		return {ReturnStatus::Result::Failure, "Could not determine "
-		    "if '" + identifier + "' exists in database (message "
-		    "was: " + (rs.message ? *rs.message : "")};
+		return (rs);
+	this->references.apply(JournalOperation::Insert, buffer);
+	++this->references.journalRecords;
+	this->scheduleCompaction();
 
-	return (Util::writeTemplate(databaseDirectory, referenceTemplate,
-	    truncate));
+	return {};
 }
 
 ELFT::ReturnStatus
 ELFT::RandomImplementation::SearchImplementation::remove(
     const std::string &identifier)
 {
-	auto [rs, exists] = this->exists(identifier);
-	if (!rs)
-		return {ReturnStatus::Result::Failure, "Could not determine "
-		    "if '" + identifier + "' exists in database (message "
-		    "was: " + (rs.message ? *rs.message : "") + ')'};
-
-	if (!exists)
+	std::unique_lock<std::shared_mutex> lock{this->mutex};
+	if (!this->references.index.find(identifier))
 		return {};
 
-	std::error_code error{};
-	std::filesystem::remove(this->databaseDirectory / identifier, error);
-	if (error)
+	const TemplateBuffer payload{reinterpret_cast<const std::byte *>(
+	    identifier.data()), identifier.size()};
+	const auto rs = this->journal.append(JournalOperation::Remove, payload);
+	if (!rs)
 		return {ReturnStatus::Result::Failure, "Could not remove '" +
-		    identifier + "' from database (error was: "+
-		    error.message() + ')'};
+		    identifier + "' from database (error was: " +
+		    (rs.message ? *rs.message : "") + ')'};
+	this->references.apply(JournalOperation::Remove, payload);
+	++this->references.journalRecords;
+	this->scheduleCompaction();
+
 	return {};
 }
 
@@ -370,43 +1886,158 @@ ELFT::RandomImplementation::SearchImplementation::search(
     const
 {
 	ELFT::SearchResult result{};
-	result.candidateList.reserve(maxCandidates);
-
-	/* Get some real candidate names */
-	for (const auto &f : std::filesystem::directory_iterator(
-	    this->databaseDirectory)) {
-		const auto &templates = Util::parseTemplate(f.path());
-		const auto &matchingTemplate = templates.at(
-		    this->rng() % templates.size());
-
-		/* Set a realistic FRGP for slap templates */
-		auto frgp = matchingTemplate.frgp;
-		switch (frgp) {
-		case FrictionRidgeGeneralizedPosition::RightFour:
-			frgp = static_cast<FrictionRidgeGeneralizedPosition>(
-			    (this->rng() % 4) + 2);
-			break;
-		case FrictionRidgeGeneralizedPosition::LeftFour:
-			frgp = static_cast<FrictionRidgeGeneralizedPosition>(
-			    (this->rng() % 4) + 7);
-			break;
-		case FrictionRidgeGeneralizedPosition::RightAndLeftThumbs:
-			frgp = static_cast<FrictionRidgeGeneralizedPosition>(
-			    (this->rng() % 2) + 5);
-			break;
-		default:
-			break;
+	if (maxCandidates == 0)
+		return (result);
+
+	std::shared_lock<std::shared_mutex> lock{this->mutex};
+	const auto &references = this->references;
+
+	const uint64_t probeSeed{Util::deriveSeed(this->configuration.seed,
+	    Util::hash(probeTemplate.data(), probeTemplate.size()))};
+
+	/* Only reference positions that could match the probe's are scored */
+	uint64_t compatible{};
+	for (const auto &t : TemplateView(probeTemplate))
+		compatible |= Util::compatiblePositions(t.frgp);
+	if (compatible == 0)
+		compatible = Constants::allPositions;
+	const auto isCompatible = [&](const FrictionRidgeGeneralizedPosition
+	    frgp) {
+		return ((compatible & (uint64_t{1} << Util::positionBit(frgp)))
+		    != 0);
+	};
+
+	/* Positions of the fingers within each slap, from RightFour */
+	constexpr auto firstSlap = FrictionRidgeGeneralizedPosition::RightFour;
+	static const auto slapFingers = []() {
+		std::array<uint64_t, 3> fingers{};
+		for (uint8_t f{1}; f <= 10; ++f) {
+			const auto finger = static_cast<
+			    FrictionRidgeGeneralizedPosition>(f);
+			fingers[static_cast<std::size_t>(
+			    static_cast<int>(*Util::slapContaining(finger)) -
+			    static_cast<int>(firstSlap))] |=
+			    (uint64_t{1} << Util::positionBit(finger));
 		}
+		return (fingers);
+	}();
 
-		result.candidateList.push_back({
-		    matchingTemplate.candidateIdentifier, frgp,
-		    static_cast<double>(this->rng() % UINT16_MAX)});
-
-		if (result.candidateList.size() == maxCandidates)
-			break;
+	/*
+	 * Shard the buckets of compatible positions, scoring a reference only
+	 * from the bucket of its lowest compatible position. When that would
+	 * visit more entries than there are references, shard every position.
+	 */
+	struct Shard
+	{
+		/** Bucket, or all positions. */
+		std::optional<unsigned int> bucket{};
+		/** Range of positions, or of indices in the bucket. */
+		uint64_t first{};
+		uint64_t last{};
+	};
+	std::vector<Shard> shards{};
+	const auto addShards = [&](const std::optional<unsigned int> bucket,
+	    const uint64_t size) {
+		for (uint64_t first{}; first < size;
+		    first += Constants::searchShardSize)
+			shards.push_back({bucket, first, std::min(size,
+			    first + Constants::searchShardSize)});
+	};
+	uint64_t bucketed{};
+	for (unsigned int bit{}; bit < references.buckets.size(); ++bit)
+		if (compatible & (uint64_t{1} << bit))
+			bucketed += references.buckets[bit].size();
+	if (bucketed < references.superseded.size()) {
+		for (unsigned int bit{}; bit < references.buckets.size(); ++bit)
+			if (compatible & (uint64_t{1} << bit))
+				addShards(bit, references.buckets[bit].size());
+	} else {
+		addShards({}, references.superseded.size());
 	}
 
-	result.decision = ((this->rng() % 2) == 0);
+	/* Score shards in parallel */
+	std::vector<TopCandidates> shardCandidates(shards.size(),
+	    TopCandidates(maxCandidates));
+	this->pool.parallelFor(shards.size(), [&](const std::size_t shard) {
+		const auto &range = shards[shard];
+		auto &candidates = shardCandidates[shard];
+		for (uint64_t k{range.first}; k < range.last; ++k) {
+			const uint64_t i{range.bucket ?
+			    references.buckets[*range.bucket][k] : k};
+			if (references.superseded[i])
+				continue;
+			const auto common = references.positionMasks[i] &
+			    compatible;
+			if (common == 0)
+				continue;
+			if (range.bucket && ((common & (~common + 1)) !=
+			    (uint64_t{1} << *range.bucket)))
+				continue;
+
+			const TemplateView reference{references.reference(i)};
+			uint64_t numCompatible{};
+			for (const auto &t : reference)
+				if (isCompatible(t.frgp))
+					++numCompatible;
+			if (numCompatible == 0)
+				continue;
+
+			/* Scores don't depend on how the database is sharded */
+			SplitMix64 rng{Util::deriveSeed(probeSeed, i)};
+			auto pick = rng() % numCompatible;
+			SubTemplate matchingTemplate{};
+			for (const auto &t : reference) {
+				if (isCompatible(t.frgp) && (pick-- == 0)) {
+					matchingTemplate = t;
+					break;
+				}
+			}
+
+			/*
+			 * Set a realistic FRGP for slap templates, preferring
+			 * fingers compatible with the probe.
+			 */
+			auto frgp = matchingTemplate.frgp;
+			const auto slap = static_cast<int>(frgp) -
+			    static_cast<int>(firstSlap);
+			if ((slap >= 0) && (static_cast<std::size_t>(slap) <
+			    slapFingers.size())) {
+				const auto slapMask = slapFingers[
+				    static_cast<std::size_t>(slap)];
+				auto fingers = slapMask & compatible;
+				if (fingers == 0)
+					fingers = slapMask;
+				auto finger = rng() % std::bitset<64>(fingers).
+				    count();
+				for (unsigned int bit{}; bit < 64; ++bit) {
+					if (((fingers & (uint64_t{1} << bit)) != 0) &&
+					    (finger-- == 0)) {
+						frgp = static_cast<
+						    FrictionRidgeGeneralizedPosition>(
+						    bit);
+						break;
+					}
+				}
+			}
+
+			candidates.push({static_cast<double>(
+			    rng() % UINT16_MAX), i, frgp});
+		}
+	});
+
+	/* Merge shards, keeping the most similar candidates */
+	TopCandidates top(maxCandidates);
+	for (const auto &candidates : shardCandidates)
+		top.merge(candidates);
+
+	const auto entries = top.sorted();
+	result.candidateList.reserve(entries.size());
+	for (const auto &entry : entries)
+		result.candidateList.emplace_back(std::string(TemplateView(
+		    references.reference(entry.position)).identifier()),
+		    entry.frgp, entry.similarity);
+
+	result.decision = ((SplitMix64{probeSeed}() % 2) == 0);
 
 	return (result);
 }
@@ -417,89 +2048,91 @@ ELFT::RandomImplementation::SearchImplementation::extractCorrespondence(
     const SearchResult &searchResult)
     const
 {
-	const auto probe = Util::parseTemplate(probeTemplate).front();
+	const TemplateView probeView{probeTemplate};
+	if (probeView.begin() == probeView.end())
+		return {};
+	const auto probe = *probeView.begin();
+	const uint64_t probeSeed{Util::deriveSeed(this->configuration.seed,
+	    Util::hash(probeTemplate.data(), probeTemplate.size()))};
+	std::shared_lock<std::shared_mutex> lock{this->mutex};
 	std::vector<std::vector<ELFT::Correspondence>> allCorrespondence{};
 	allCorrespondence.reserve(searchResult.candidateList.size());
 
 	for (const auto &c : searchResult.candidateList) {
-		const auto &referenceTemplates = Util::parseTemplate(
-		    this->databaseDirectory / c.identifier);
-
-		/* NOTE: See NOTE below. This won't line up. */
-		bool onlySlaps{true};
+		/* References are resident and indexed; no cache is needed */
+		const auto position = this->references.index.find(c.identifier);
+		if (!position) {
+			allCorrespondence.emplace_back();
+			continue;
+		}
+		const TemplateView referenceTemplates{
+		    this->references.reference(*position)};
+		SplitMix64 rng{Util::deriveSeed(probeSeed, Util::hash(
+		    c.identifier.data(), c.identifier.size()))};
+
+		/*
+		 * Find the subtemplate at the candidate's position, or else the
+		 * slap that contains it.
+		 *
+		 * NOTE: See NOTE below. If we did something like this in
+		 *       production, we'd need to include an ROI.
+		 */
+		std::optional<SubTemplate> matching{};
 		for (const auto &tmpl : referenceTemplates) {
-			if ((static_cast<uint8_t>(tmpl.frgp) < 13) ||
-			    (static_cast<uint8_t>(tmpl.frgp) > 15)) {
-				onlySlaps = false;
+			if (tmpl.frgp == c.frgp) {
+				matching = tmpl;
 				break;
 			}
-			/*
-			 * NOTE: See NOTE below. If we did something like this
-			 *       in production, we'd need to include an ROI.
-			 */
 		}
-
-		for (const auto &tmpl : referenceTemplates) {
-			/* Find the correct subtemplate within the reference */
-			if (onlySlaps) {
-				using frgp_t = std::underlying_type<
-				    FrictionRidgeGeneralizedPosition>::type;
-				const auto c_frgp = static_cast<frgp_t>(c.frgp);
-				const auto tmpl_frgp = static_cast<frgp_t>(
-				    tmpl.frgp);
-
-				if (c_frgp >= 2 && c_frgp <= 5) {
-					if (tmpl_frgp != 13)
-						continue;
-				} else if (c_frgp >= 7 && c_frgp <= 10) {
-					if (tmpl_frgp != 14)
-						continue;
-				} else {
-					if (tmpl_frgp != 15)
-						continue;
+		if (!matching) {
+			const auto slap = Util::slapContaining(c.frgp);
+			for (const auto &tmpl : referenceTemplates) {
+				if (slap && (tmpl.frgp == *slap)) {
+					matching = tmpl;
+					break;
 				}
-			} else {
-				if (tmpl.frgp != c.frgp)
-					continue;
 			}
+		}
+		if (!matching) {
+			allCorrespondence.emplace_back();
+			continue;
+		}
 
-			const uint8_t numMinutia{static_cast<uint8_t>(
-			    this->rng() % UINT8_MAX)};
-
-			/*
-			 * NOTE: ELFT requires that corresponding minutiae be
-			 *       from the set of minutiae returned in
-			 *       extractTemplateData() for both templates.
-			 *       There's no easy way to do so in this example.
-			 */
-			std::vector<Correspondence> candidateCorr{};
-			candidateCorr.reserve(numMinutia);
-			for (uint8_t i{}; i < numMinutia; ++i) {
-				Correspondence singleCorr{};
-				singleCorr.probeInputIdentifier =
-				    probe.inputIdentifier;
-				singleCorr.referenceInputIdentifier =
-				    tmpl.inputIdentifier;
-
-				singleCorr.probeMinutia.coordinate.x =
-				    static_cast<uint16_t>(this->rng() % 1000);
-				singleCorr.probeMinutia.coordinate.y =
-				    static_cast<uint16_t>(this->rng() % 1000);
-				singleCorr.probeMinutia.theta =
-				    static_cast<uint16_t>(this->rng() % 360);
-
-				singleCorr.referenceMinutia.coordinate.x =
-				    static_cast<uint16_t>(this->rng() % 1000);
-				singleCorr.referenceMinutia.coordinate.y =
-				    static_cast<uint16_t>(this->rng() % 1000);
-				singleCorr.referenceMinutia.theta =
-				    static_cast<uint16_t>(this->rng() % 16);
-
-				candidateCorr.push_back(singleCorr);
-			}
-			allCorrespondence.push_back(candidateCorr);
-			break;
+		const uint8_t numMinutia{static_cast<uint8_t>(
+		    rng() % UINT8_MAX)};
+
+		/*
+		 * NOTE: ELFT requires that corresponding minutiae be
+		 *       from the set of minutiae returned in
+		 *       extractTemplateData() for both templates.
+		 *       There's no easy way to do so in this example.
+		 */
+		std::vector<Correspondence> candidateCorr{};
+		candidateCorr.reserve(numMinutia);
+		for (uint8_t i{}; i < numMinutia; ++i) {
+			Correspondence singleCorr{};
+			singleCorr.probeInputIdentifier =
+			    probe.inputIdentifier;
+			singleCorr.referenceInputIdentifier =
+			    matching->inputIdentifier;
+
+			singleCorr.probeMinutia.coordinate.x =
+			    static_cast<uint16_t>(rng() % 1000);
+			singleCorr.probeMinutia.coordinate.y =
+			    static_cast<uint16_t>(rng() % 1000);
+			singleCorr.probeMinutia.theta =
+			    static_cast<uint16_t>(rng() % 360);
+
+			singleCorr.referenceMinutia.coordinate.x =
+			    static_cast<uint16_t>(rng() % 1000);
+			singleCorr.referenceMinutia.coordinate.y =
+			    static_cast<uint16_t>(rng() % 1000);
+			singleCorr.referenceMinutia.theta =
+			    static_cast<uint16_t>(rng() % 16);
+
+			candidateCorr.push_back(singleCorr);
 		}
+		allCorrespondence.push_back(candidateCorr);
 	}
 
 	return (allCorrespondence);
@@ -11,7 +11,22 @@
 #ifndef ELFT_RANDIMPL_H_
 #define ELFT_RANDIMPL_H_
 
-#include <random>
+#include <sys/types.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
 
 #include <elft.h>
 
@@ -24,22 +39,250 @@ namespace ELFT
 		{
 			/** Random-number engine seed. */
 			std::uint_fast32_t seed{};
+			/**
+			 * Number of threads that may be used per operation, if
+			 * configured.
+			 */
+			std::optional<unsigned int> numThreads{};
 		};
 
-		/** Template format */
-		struct Tmpl
+		/**
+		 * Counter-based random number engine (SplitMix64). Engines are
+		 * cheap to create, so each operation derives its own from the
+		 * configured seed and the data it operates on, and shares no
+		 * state with other threads.
+		 */
+		class SplitMix64
+		{
+		public:
+			using result_type = uint64_t;
+
+			/**
+			 * @brief
+			 * SplitMix64 constructor.
+			 *
+			 * @param seed
+			 * Starting value of the counter.
+			 */
+			explicit SplitMix64(
+			    const uint64_t seed);
+
+			/** @return Next value in the sequence. */
+			result_type
+			operator()();
+
+			static constexpr result_type
+			min()
+			{
+				return (0);
+			}
+
+			static constexpr result_type
+			max()
+			{
+				return (UINT64_MAX);
+			}
+
+		private:
+			/** Counter, advanced on each call. */
+			uint64_t state{};
+		};
+
+		/** Non-owning reference to a combined "ELFT" template. */
+		struct TemplateBuffer
+		{
+			/** First byte of the template. */
+			const std::byte *data{};
+			/** Number of bytes in the template. */
+			std::size_t size{};
+		};
+
+		/** One "native" template within a combined "ELFT" template. */
+		struct SubTemplate
 		{
-			/** Candidate name. */
-			std::string candidateIdentifier{};
 			/** Input identifier from createTemplate(). */
 			uint8_t inputIdentifier{};
 			/** Finger position */
 			FrictionRidgeGeneralizedPosition frgp{};
+			/** Native template, pointing into the combined template. */
+			TemplateBuffer payload{};
+		};
+
+		/**
+		 * Non-owning, allocation-free reader of a combined "ELFT"
+		 * template: a NUL-terminated identifier followed by "native"
+		 * templates, each with a three byte header (input identifier,
+		 * FRGP, and number of bytes that follow).
+		 */
+		class TemplateView
+		{
+		public:
+			/** Forward iterator over the "native" templates. */
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = SubTemplate;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const SubTemplate*;
+				using reference = const SubTemplate&;
+
+				/**
+				 * @brief
+				 * Iterator constructor.
+				 *
+				 * @param position
+				 * Header of the first "native" template.
+				 * @param end
+				 * One past the last byte of the combined
+				 * template.
+				 */
+				Iterator(
+				    const std::byte *position,
+				    const std::byte *end);
+
+				reference
+				operator*()
+				    const
+				    noexcept;
+
+				pointer
+				operator->()
+				    const
+				    noexcept;
+
+				Iterator&
+				operator++();
+
+				Iterator
+				operator++(int);
+
+				bool
+				operator==(
+				    const Iterator &rhs)
+				    const
+				    noexcept;
+
+				bool
+				operator!=(
+				    const Iterator &rhs)
+				    const
+				    noexcept;
+
+			private:
+				/**
+				 * Decode the header at #position, or move to
+				 * #end if it or its payload is truncated.
+				 */
+				void
+				decode();
+
+				/** Header of #current. */
+				const std::byte *position{};
+				/** One past the last byte of the template. */
+				const std::byte *end{};
+				/** "Native" template at #position. */
+				SubTemplate current{};
+			};
+
 			/**
-			 * After this byte, remaining number of bytes for this
-			 * template.
+			 * @brief
+			 * TemplateView constructor.
+			 *
+			 * @param templateData
+			 * Combined "ELFT" template created in createTemplate(),
+			 * which must outlive this object.
 			 */
-			uint8_t size{};
+			explicit TemplateView(
+			    const TemplateBuffer templateData);
+
+			/**
+			 * @brief
+			 * TemplateView constructor.
+			 *
+			 * @param templateData
+			 * Combined "ELFT" template created in createTemplate(),
+			 * which must outlive this object.
+			 */
+			explicit TemplateView(
+			    const std::vector<std::byte> &templateData);
+
+			/** @return Identifier, pointing into the template. */
+			std::string_view
+			identifier()
+			    const
+			    noexcept;
+
+			Iterator
+			begin()
+			    const;
+
+			Iterator
+			end()
+			    const;
+
+			/** @return Number of "native" templates. */
+			std::size_t
+			size()
+			    const;
+
+		private:
+			/** Identifier that begins the template. */
+			std::string_view id{};
+			/** Header of the first "native" template. */
+			const std::byte *first{};
+			/** One past the last byte of the template. */
+			const std::byte *last{};
+		};
+
+		/** First bytes of the packed reference database file. */
+		struct DatabaseHeader
+		{
+			/** Constants::databaseMagic */
+			char magic[8]{};
+			/** Constants::databaseVersion */
+			uint32_t version{};
+			/** Unused, keeps entries 8-byte aligned. */
+			uint32_t reserved{};
+			/** Number of DatabaseEntry following the header. */
+			uint64_t count{};
+		};
+
+		/**
+		 * Location of one template in the packed reference database.
+		 * Entries immediately follow DatabaseHeader and are sorted by
+		 * the identifier that begins each template.
+		 */
+		struct DatabaseEntry
+		{
+			/** Offset of the template from the start of the file. */
+			uint64_t offset{};
+			/** Number of bytes in the template. */
+			uint64_t size{};
+			/** Util::positionMask() of the template. */
+			uint64_t positions{};
+		};
+
+		/** Modification recorded in the journal. */
+		enum class JournalOperation : uint32_t
+		{
+			/** Payload is a combined "ELFT" template. */
+			Insert = 1,
+			/** Payload is an identifier. */
+			Remove = 2
+		};
+
+		/** Header of one modification in the journal. */
+		struct JournalRecord
+		{
+			/** JournalOperation */
+			uint32_t operation{};
+			/** Unused. */
+			uint32_t reserved{};
+			/** Number of payload bytes following the header. */
+			uint64_t size{};
+			/** Detects records torn by a crash while appending. */
+			uint64_t checksum{};
 		};
 
 		namespace Constants
@@ -48,8 +291,672 @@ namespace ELFT
 			uint16_t productOwner{0x000F};
 			std::string libraryIdentifier{"randimpl"};
 			std::string configFileName{"seed"};
+			/** Optional file containing number of threads to use. */
+			std::string threadsFileName{"threads"};
+			/** Number of references scored together by one thread. */
+			uint64_t searchShardSize{4096};
+			/** Number of templates written together by one thread. */
+			uint64_t writeShardSize{4096};
+			/** Mask of every FRGP, used when the probe's is unknown. */
+			uint64_t allPositions{UINT64_MAX};
+
+			/** Name of packed file within database directory. */
+			std::string databaseFileName{"references.db"};
+			/** Identifies a file as a packed reference database. */
+			std::string_view databaseMagic{"RANDIMPL", 8};
+			/** Version of the packed reference database format. */
+			uint32_t databaseVersion{2};
+
+			/** Name of the journal within database directory. */
+			std::string journalFileName{"references.journal"};
+			/** Name of a journal being folded into the database. */
+			std::string compactingJournalFileName{
+			    "references.journal.compacting"};
+			/** Fewest journal records that trigger compaction. */
+			uint64_t journalCompactionMinimum{1024};
 		}
 
+		/** Read-only, shared memory mapping of an entire file. */
+		class MappedFile
+		{
+		public:
+			/**
+			 * @brief
+			 * MappedFile constructor.
+			 *
+			 * @param path
+			 * File to map.
+			 *
+			 * @throw runtime_error
+			 * Error opening or mapping `path`.
+			 */
+			MappedFile(
+			    const std::filesystem::path &path);
+
+			/** Empty mapping. */
+			MappedFile();
+
+			MappedFile(MappedFile &&rhs) noexcept;
+			MappedFile& operator=(MappedFile &&rhs) noexcept;
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+			~MappedFile();
+
+			/** @return First byte of the file. */
+			const std::byte*
+			data()
+			    const
+			    noexcept;
+
+			/** @return Number of bytes in the file. */
+			std::size_t
+			size()
+			    const
+			    noexcept;
+
+		private:
+			/** Address returned from mmap(). */
+			void *address{};
+			/** Length of #address. */
+			std::size_t length{};
+		};
+
+		/**
+		 * The most similar references seen during a search, held in a
+		 * fixed-capacity min-heap so the least similar is replaced in
+		 * O(log K) without allocating.
+		 */
+		class TopCandidates
+		{
+		public:
+			/** Reference that was scored during a search. */
+			struct Entry
+			{
+				/** Quantification of similarity to the probe. */
+				double similarity{};
+				/** Position of the reference in the database. */
+				uint64_t position{};
+				/** Most localized position of the match. */
+				FrictionRidgeGeneralizedPosition frgp{};
+			};
+
+			/**
+			 * @brief
+			 * TopCandidates constructor.
+			 *
+			 * @param capacity
+			 * Maximum number of entries to keep.
+			 */
+			TopCandidates(
+			    const std::size_t capacity);
+
+			/**
+			 * @brief
+			 * Consider a scored reference.
+			 *
+			 * @param entry
+			 * Scored reference.
+			 */
+			void
+			push(
+			    const Entry &entry);
+
+			/**
+			 * @brief
+			 * Consider every entry of another TopCandidates.
+			 *
+			 * @param other
+			 * Entries to consider.
+			 */
+			void
+			merge(
+			    const TopCandidates &other);
+
+			/**
+			 * @return
+			 * Entries by descending similarity. Equal similarities
+			 * are ordered by ascending position, matching a
+			 * stable sort of the database in order.
+			 */
+			std::vector<Entry>
+			sorted()
+			    const;
+
+		private:
+			/**
+			 * @return
+			 * `true` if `lhs` ranks ahead of `rhs`, making the heap
+			 * top the lowest-ranked entry.
+			 */
+			static bool
+			ranksAhead(
+			    const Entry &lhs,
+			    const Entry &rhs);
+
+			/** Maximum number of entries. */
+			const std::size_t capacity{};
+			/** Heap ordered by ranksAhead(). */
+			std::vector<Entry> heap{};
+		};
+
+		/**
+		 * Fixed set of worker threads, started on first use. Threads
+		 * are restarted if the pool is first used after a fork(), and
+		 * each pool's mutex is held across fork() so that the child
+		 * never inherits it locked.
+		 */
+		class ThreadPool
+		{
+		public:
+			/**
+			 * @brief
+			 * ThreadPool constructor.
+			 *
+			 * @param numThreads
+			 * Maximum number of threads working on a single call to
+			 * parallelFor(), including the calling thread. When not
+			 * provided, all available cores are used in this
+			 * process, and one thread in processes forked from it,
+			 * which the caller is already running in parallel.
+			 */
+			ThreadPool(
+			    const std::optional<unsigned int> numThreads);
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator=(const ThreadPool&) = delete;
+			~ThreadPool();
+
+			/**
+			 * @brief
+			 * Call `task` once for each index in [0, `count`),
+			 * spread across the pool and the calling thread.
+			 *
+			 * @param count
+			 * Number of indices.
+			 * @param task
+			 * Function to call with each index.
+			 *
+			 * @throw
+			 * First exception thrown by `task`, after all running
+			 * tasks have completed.
+			 */
+			void
+			parallelFor(
+			    const std::size_t count,
+			    const std::function<void(std::size_t)> &task);
+
+			/** @return Maximum threads used by parallelFor(). */
+			unsigned int
+			size()
+			    const
+			    noexcept;
+
+		private:
+			/**
+			 * Forget #threads and #available, which were inherited
+			 * from the process that started the threads.
+			 *
+			 * @note
+			 * Both are leaked: the threads don't exist in this
+			 * process, so they can be neither joined nor detached,
+			 * and #available can't be destroyed without them.
+			 */
+			void
+			abandon();
+
+			/** Start worker threads, if not started by this PID. */
+			void
+			start();
+
+			/** Run queued tasks until stopped. */
+			void
+			work();
+
+			/** Lock the mutex of every pool before fork(). */
+			static void
+			lockAll();
+
+			/** Unlock the mutex of every pool after fork(). */
+			static void
+			unlockAll();
+
+			/** Mutex protecting the set of all pools. */
+			static std::mutex&
+			poolsMutex();
+
+			/** @return All pools in this process. */
+			static std::set<ThreadPool*>&
+			pools();
+
+			/** Configured maximum threads used by parallelFor(). */
+			const std::optional<unsigned int> numThreads{};
+			/** Process that constructed this pool. */
+			const pid_t creator{};
+
+			/** Worker threads. */
+			std::vector<std::thread> threads{};
+			/** Process that started #threads. */
+			pid_t owner{};
+			/** Tasks waiting for a worker. */
+			std::deque<std::function<void()>> queue{};
+			/** Protects #queue, #threads, and #stopping. */
+			std::mutex mutex{};
+			/** Signaled when #queue or #stopping change. */
+			std::unique_ptr<std::condition_variable> available{
+			    std::make_unique<std::condition_variable>()};
+			/** Workers should exit. */
+			bool stopping{false};
+		};
+
+		/**
+		 * Set membership test that may report false positives but never
+		 * false negatives, used to reject most absent identifiers
+		 * without probing IdentifierIndex.
+		 */
+		class BloomFilter
+		{
+		public:
+			/**
+			 * @brief
+			 * BloomFilter constructor.
+			 *
+			 * @param capacity
+			 * Number of elements that can be added before the
+			 * false positive rate exceeds roughly 1%.
+			 */
+			BloomFilter(
+			    const std::size_t capacity = 0);
+
+			/**
+			 * @brief
+			 * Add an element.
+			 *
+			 * @param hash
+			 * Hash of the element.
+			 */
+			void
+			add(
+			    const uint64_t hash);
+
+			/**
+			 * @param hash
+			 * Hash of the element.
+			 *
+			 * @return
+			 * `false` if the element was never added.
+			 */
+			bool
+			mayContain(
+			    const uint64_t hash)
+			    const
+			    noexcept;
+
+		private:
+			/** Number of bit positions tested per element. */
+			static constexpr unsigned int numHashes{7};
+
+			/** Bit array, a power of two number of bits long. */
+			std::vector<uint64_t> bits{};
+		};
+
+		/**
+		 * Open-addressing (linear probing) hash table from template
+		 * identifier to a position, fronted by a BloomFilter.
+		 * Identifiers are not copied, so the storage they view must
+		 * outlive their entry.
+		 */
+		class IdentifierIndex
+		{
+		public:
+			/**
+			 * @brief
+			 * Add or replace an entry.
+			 *
+			 * @param identifier
+			 * Template identifier.
+			 * @param position
+			 * Value to associate with `identifier`.
+			 */
+			void
+			insert(
+			    const std::string_view identifier,
+			    const uint64_t position);
+
+			/**
+			 * @brief
+			 * Remove an entry.
+			 *
+			 * @param identifier
+			 * Template identifier.
+			 *
+			 * @return
+			 * `true` if `identifier` was present.
+			 */
+			bool
+			erase(
+			    const std::string_view identifier);
+
+			/**
+			 * @param identifier
+			 * Template identifier.
+			 *
+			 * @return
+			 * Position associated with `identifier`, if present.
+			 */
+			std::optional<uint64_t>
+			find(
+			    const std::string_view identifier)
+			    const;
+
+			/** Remove all entries. */
+			void
+			clear();
+
+			/** @return Number of entries. */
+			std::size_t
+			size()
+			    const
+			    noexcept;
+
+		private:
+			/** One bucket of the table. */
+			struct Slot
+			{
+				/** Template identifier. */
+				std::string_view identifier{};
+				/** Util::hash() of #identifier. */
+				uint64_t hash{};
+				/** Value associated with #identifier. */
+				uint64_t position{};
+				/** Bucket holds an entry. */
+				bool occupied{false};
+				/** Bucket held an entry that was erased. */
+				bool erased{false};
+			};
+
+			/**
+			 * @return
+			 * Index of the slot holding `identifier`, if present.
+			 */
+			std::optional<std::size_t>
+			locate(
+			    const std::string_view identifier,
+			    const uint64_t hash)
+			    const;
+
+			/**
+			 * @brief
+			 * Rebuild the table and filter with room for at least
+			 * `capacity` entries, discarding erased slots.
+			 */
+			void
+			rehash(
+			    const std::size_t capacity);
+
+			/** Buckets, a power of two in number. */
+			std::vector<Slot> slots{};
+			/** Number of occupied slots. */
+			std::size_t count{};
+			/** Number of occupied and erased slots. */
+			std::size_t used{};
+			/** Identifiers that were ever added since rehash(). */
+			BloomFilter filter{};
+		};
+
+		/**
+		 * Reference database packed into a single file: DatabaseHeader,
+		 * a table of DatabaseEntry sorted by identifier, and the
+		 * contiguous templates.
+		 */
+		class ReferenceDatabase
+		{
+		public:
+			/**
+			 * @brief
+			 * Map a packed reference database.
+			 *
+			 * @param path
+			 * Path to the packed database file. If the file does
+			 * not exist, the database is empty.
+			 *
+			 * @throw runtime_error
+			 * `path` exists but is not a packed reference database.
+			 */
+			ReferenceDatabase(
+			    const std::filesystem::path &path);
+
+			/** Empty database. */
+			ReferenceDatabase();
+
+			/** @return Number of templates in the database. */
+			uint64_t
+			size()
+			    const
+			    noexcept;
+
+			/**
+			 * @brief
+			 * Obtain a template from the database.
+			 *
+			 * @param position
+			 * Position of the template, [0, size()).
+			 *
+			 * @return
+			 * View of the template, valid for the lifetime of this
+			 * object.
+			 *
+			 * @throw runtime_error
+			 * Entry points outside of the file.
+			 */
+			TemplateBuffer
+			at(
+			    const uint64_t position)
+			    const;
+
+			/**
+			 * @param position
+			 * Position of the template, [0, size()).
+			 *
+			 * @return
+			 * Util::positionMask() of the template.
+			 */
+			uint64_t
+			positions(
+			    const uint64_t position)
+			    const;
+
+			/**
+			 * @brief
+			 * Write a packed reference database.
+			 *
+			 * @param path
+			 * Path to the packed database file. Replaced
+			 * atomically if it already exists, and on stable
+			 * storage (including its directory entry) when this
+			 * returns successfully.
+			 * @param templates
+			 * Templates to write. When an identifier appears more
+			 * than once, the last occurrence is kept.
+			 * @param pool
+			 * Threads used to sort and write shards of `templates`.
+			 * @param maxSize
+			 * Fail without writing if the file would be larger
+			 * than this many bytes.
+			 *
+			 * @return
+			 * Status of completing this operation.
+			 */
+			static ReturnStatus
+			write(
+			    const std::filesystem::path &path,
+			    std::vector<TemplateBuffer> templates,
+			    ThreadPool &pool,
+			    const uint64_t maxSize = UINT64_MAX);
+
+		private:
+			/**
+			 * @return
+			 * Entry for the template at `position`.
+			 *
+			 * @throw runtime_error
+			 * Entry points outside of the file.
+			 */
+			DatabaseEntry
+			entry(
+			    const uint64_t position)
+			    const;
+
+			/** Mapping of the entire packed database file. */
+			MappedFile file{};
+			/** Number of templates in #file. */
+			uint64_t count{};
+		};
+
+		/**
+		 * Append-only file of JournalRecord, each followed by its
+		 * payload, recording modifications made since the reference
+		 * database was last written.
+		 */
+		class Journal
+		{
+		public:
+			/**
+			 * @brief
+			 * Journal constructor. The file is not opened until
+			 * the first append().
+			 *
+			 * @param path
+			 * Path to the journal file.
+			 */
+			Journal(
+			    const std::filesystem::path &path);
+
+			Journal(const Journal&) = delete;
+			Journal& operator=(const Journal&) = delete;
+			~Journal();
+
+			/**
+			 * @brief
+			 * Append a record. The first append removes a record
+			 * torn by a crash from the end of the journal.
+			 *
+			 * @param operation
+			 * Modification being made.
+			 * @param payload
+			 * Template or identifier, depending on `operation`.
+			 *
+			 * @return
+			 * Status of completing this operation. On success, the
+			 * record is on stable storage. On failure, the file is
+			 * left as it was.
+			 */
+			ReturnStatus
+			append(
+			    const JournalOperation operation,
+			    const TemplateBuffer payload);
+
+			/** Close the file, if open. */
+			void
+			close();
+
+			/**
+			 * @brief
+			 * Apply each complete record in a journal, stopping at
+			 * any torn record at the end of the file. Nothing is
+			 * written, so `path` may be read-only; the torn record
+			 * is removed by the next append().
+			 *
+			 * @param path
+			 * Path to the journal file, which need not exist.
+			 * @param apply
+			 * Function called with each record, in order. The
+			 * payload is only valid during the call.
+			 *
+			 * @return
+			 * Number of records applied.
+			 *
+			 * @throw runtime_error
+			 * Error reading `path`.
+			 */
+			static uint64_t
+			replay(
+			    const std::filesystem::path &path,
+			    const std::function<void(JournalOperation,
+			        TemplateBuffer)> &apply);
+
+			/**
+			 * @brief
+			 * Move the records of one journal to the end of
+			 * another.
+			 *
+			 * @param source
+			 * Journal to empty. Records are copied before `source`
+			 * is removed, so replaying both after a crash applies
+			 * some records twice, which is harmless.
+			 * @param destination
+			 * Journal to extend, which need not exist.
+			 *
+			 * @return
+			 * Status of completing this operation.
+			 */
+			static ReturnStatus
+			rotate(
+			    const std::filesystem::path &source,
+			    const std::filesystem::path &destination);
+
+		private:
+			/**
+			 * @brief
+			 * Remove a torn record from the end of a journal, so
+			 * that records appended next can be replayed.
+			 *
+			 * @param fd
+			 * Descriptor of `path`, open for writing.
+			 * @param path
+			 * Path to the journal file.
+			 *
+			 * @return
+			 * Status of completing this operation.
+			 */
+			static ReturnStatus
+			truncateTorn(
+			    const int fd,
+			    const std::filesystem::path &path);
+
+			/**
+			 * @brief
+			 * Find the complete records at the start of a journal.
+			 *
+			 * @param file
+			 * Mapped journal.
+			 * @param apply
+			 * Function called with each record, in order, or
+			 * `nullptr`.
+			 *
+			 * @return
+			 * Number of bytes of complete records.
+			 */
+			static uint64_t
+			scan(
+			    const MappedFile &file,
+			    const std::function<void(JournalOperation,
+			        TemplateBuffer)> *apply);
+
+			/**
+			 * @return
+			 * Checksum of a record's header fields and payload.
+			 */
+			static uint64_t
+			checksum(
+			    const JournalRecord &record,
+			    const std::byte *payload);
+
+			/** Path to the journal file. */
+			const std::filesystem::path path{};
+			/** Descriptor opened for appending, or -1. */
+			int fd{-1};
+		};
+
 		namespace Util
 		{
 			/**
@@ -66,55 +973,108 @@ namespace ELFT
 
 			/**
 			 * @brief
-			 * Extract individual "native" templates from single
-			 * "ELFT" template on disk.
+			 * Hash bytes (64-bit FNV-1a).
 			 *
-			 * @param pathToTemplate
-			 * Filesystem location of template on disk.
+			 * @param data
+			 * Bytes to hash.
+			 * @param size
+			 * Number of bytes in `data`.
 			 *
 			 * @return
-			 * Collection of individual "native" templates.
+			 * Hash of `data`.
 			 */
-			std::vector<Tmpl>
-			parseTemplate(
-			    const std::filesystem::path &pathToTemplate);
+			uint64_t
+			hash(
+			    const void *data,
+			    const std::size_t size);
 
 			/**
 			 * @brief
-			 * Extract individual "native" templates from single
-			 * "ELFT" template in memory.
+			 * Obtain the bit representing a finger, palm, or slap
+			 * position in a mask of positions.
+			 *
+			 * @param frgp
+			 * Position.
 			 *
+			 * @return
+			 * Bit number, [0, 64).
+			 */
+			unsigned int
+			positionBit(
+			    const FrictionRidgeGeneralizedPosition frgp);
+
+			/**
 			 * @param templateData
-			 * Combined "ELFT" template created in createTemplate().
+			 * Combined "ELFT" template.
 			 *
 			 * @return
-			 * Collection of individual "native" templates.
+			 * Mask with positionBit() set for each "native"
+			 * template.
 			 */
-			std::vector<Tmpl>
-			parseTemplate(
-			    const std::vector<std::byte> &templateData);
+			uint64_t
+			positionMask(
+			    const TemplateView &templateData);
 
 			/**
 			 * @brief
-			 * Write template data to disk.
+			 * Obtain the reference positions that could contain
+			 * the same friction ridge as a probe position.
+			 *
+			 * @param frgp
+			 * Position of a probe.
+			 *
+			 * @return
+			 * Mask of positionBit() for compatible reference
+			 * positions, or Constants::allPositions if any
+			 * position is compatible.
+			 */
+			uint64_t
+			compatiblePositions(
+			    const FrictionRidgeGeneralizedPosition frgp);
+
+			/**
+			 * @param frgp
+			 * Finger position.
+			 *
+			 * @return
+			 * Slap position that includes `frgp`, if any.
+			 */
+			std::optional<FrictionRidgeGeneralizedPosition>
+			slapContaining(
+			    const FrictionRidgeGeneralizedPosition frgp);
+
+			/**
+			 * @brief
+			 * Flush a directory's entries to stable storage, so
+			 * that files created, renamed, or removed in it
+			 * survive a crash.
 			 *
 			 * @param directory
-			 * Directory at which to write `templateData`. The name
-			 * of the file in the directory will be parsed from
-			 * `templateData`.
-			 * @param templateData
-			 * Combined "ELFT" template created in createTemplate().
-			 * @param truncate
-			 * Whether or not to truncate file if it already exists.
+			 * Directory to flush. Empty for the working directory.
 			 *
 			 * @return
 			 * Status of completing this operation.
 			 */
 			ReturnStatus
-			writeTemplate(
-			    const std::filesystem::path &directory,
-			    const std::vector<std::byte> &templateData,
-			    const bool truncate = true);
+			syncDirectory(
+			    const std::filesystem::path &directory);
+
+			/**
+			 * @brief
+			 * Combine two values into a seed for SplitMix64.
+			 *
+			 * @param seed
+			 * Configured seed, or output of a previous call.
+			 * @param key
+			 * Value that distinguishes this stream.
+			 *
+			 * @return
+			 * Seed for a new stream.
+			 */
+			uint64_t
+			deriveSeed(
+			    const uint64_t seed,
+			    const uint64_t key);
 		}
 
 		class ExtractionImplementation : public ExtractionInterface
@@ -156,7 +1116,10 @@ namespace ELFT
 			        &configurationDirectory);
 
 		private:
-			mutable std::mt19937_64 rng{};
+			const ConfigurationParameters configuration{};
+
+			/** Threads used to write the reference database. */
+			mutable ThreadPool pool;
 		};
 
 		class SearchImplementation : public SearchInterface
@@ -203,9 +1166,159 @@ namespace ELFT
 			        &configurationDirectory,
 			    const std::filesystem::path &databaseDirectory);
 
+			~SearchImplementation() override;
+
 		private:
+			/**
+			 * Packed database and the overlay of modifications
+			 * since it was written, replaced as a whole on reload.
+			 */
+			struct References
+			{
+				/**
+				 * @brief
+				 * Apply a journal record to the overlay.
+				 *
+				 * @param operation
+				 * Modification being made.
+				 * @param payload
+				 * Template or identifier, depending on
+				 * `operation`.
+				 */
+				void
+				apply(
+				    const JournalOperation operation,
+				    const TemplateBuffer payload);
+
+				/**
+				 * @brief
+				 * Record the positions of a template appended
+				 * to #superseded.
+				 *
+				 * @param position
+				 * Position of the template.
+				 * @param positions
+				 * Util::positionMask() of the template.
+				 */
+				void
+				track(
+				    const uint64_t position,
+				    const uint64_t positions);
+
+				/**
+				 * @param position
+				 * Position in [0, #database size +
+				 * #journalTemplates size).
+				 *
+				 * @return
+				 * Template at `position`.
+				 */
+				TemplateBuffer
+				reference(
+				    const uint64_t position)
+				    const;
+
+				/** Packed reference templates, mapped. */
+				ReferenceDatabase database{};
+				/**
+				 * Templates inserted since #database was
+				 * written, positioned after #database.
+				 */
+				std::deque<std::vector<std::byte>>
+				    journalTemplates{};
+				/** Positions that were removed or replaced. */
+				std::vector<bool> superseded{};
+				/** Util::positionMask() of each position. */
+				std::vector<uint64_t> positionMasks{};
+				/**
+				 * Positions whose mask includes each
+				 * positionBit(), so searches of a known
+				 * position skip the others.
+				 */
+				std::array<std::vector<uint64_t>, 64>
+				    buckets{};
+				/** Positions of current identifiers. */
+				IdentifierIndex index{};
+				/** Records in the journals, for compaction. */
+				uint64_t journalRecords{};
+			};
+
+			/**
+			 * @brief
+			 * Map the packed database and overlay modifications
+			 * from the journals. Nothing is written, so the
+			 * database directory may be read-only. Callers other
+			 * than the constructor must hold #mutex exclusively,
+			 * so the journal does not change while it is read.
+			 *
+			 * @param databaseDirectory
+			 * Directory containing the database and journals.
+			 *
+			 * @return
+			 * Database and overlay.
+			 *
+			 * @throw runtime_error
+			 * Error reading the database or journals.
+			 */
+			static References
+			load(
+			    const std::filesystem::path &databaseDirectory);
+
+			/**
+			 * @brief
+			 * Start compaction in the background if the journal has
+			 * grown large enough. Caller must hold #mutex
+			 * exclusively.
+			 */
+			void
+			scheduleCompaction();
+
+			/**
+			 * @brief
+			 * Wait for #compactor to finish. A compactor started by
+			 * a parent process doesn't exist in this one, so it is
+			 * forgotten (see ThreadPool::abandon()) and #compacting
+			 * is reset.
+			 */
+			void
+			reapCompactor();
+
+			/**
+			 * @brief
+			 * Write a new packed database and reload. Runs on
+			 * #compactor. If reloading fails, #references is left
+			 * as it was, and the journals are kept.
+			 *
+			 * @param templates
+			 * Every template in the database when compaction was
+			 * scheduled.
+			 */
+			void
+			compact(
+			    std::vector<TemplateBuffer> templates);
+
 			const std::filesystem::path databaseDirectory{};
-			mutable std::mt19937_64 rng{};
+			const ConfigurationParameters configuration{};
+
+			/**
+			 * Protects all state below, shared by searches and held
+			 * exclusively by modifications.
+			 */
+			mutable std::shared_mutex mutex{};
+			/** Database and overlay being searched. */
+			References references;
+			/** Records modifications not yet in the database. */
+			Journal journal;
+
+			/** Background compaction, if started. */
+			std::thread compactor{};
+			/** Process that started #compactor. */
+			pid_t compactorOwner{};
+			/** #compactor has not yet finished. */
+			std::atomic<bool> compacting{false};
+
+			/** Threads used to score shards of the database. */
+			mutable ThreadPool pool;
 		};
 	}
 }
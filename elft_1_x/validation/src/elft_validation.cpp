@@ -8,23 +8,43 @@
  * about its quality, reliability, or any other characteristic.
  */
 
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/wait.h>
 
+#include <fcntl.h>
 #include <getopt.h>
+#include <pthread.h>
 #include <unistd.h>
 
 #include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <new>
+#include <numeric>
+#include <set>
 #include <sstream>
+#include <string_view>
 #include <system_error>
 #include <thread>
+#include <unordered_map>
 #include <variant>
 
 #include <elft.h>
@@ -32,6 +52,383 @@
 #include <elft_validation_data.h>
 #include <elft_validation_utils.h>
 
+int
+ELFT::Validation::checkBudgets(
+    const Arguments &args)
+{
+	if (!std::filesystem::is_directory(args.outputDir))
+		throw std::runtime_error{"No output directory " +
+		    args.outputDir.string()};
+
+	std::vector<BudgetCompliance> compliance{};
+	std::vector<std::string> skipped{};
+	std::vector<std::string> notes{};
+	/* Count a measurement, keeping the one with least headroom */
+	const auto check = [&compliance](const std::string &budget,
+	    const double measured, const double limit,
+	    const uint64_t calls = 1) {
+		if (limit <= 0)
+			return;
+		auto it = std::find_if(compliance.begin(), compliance.end(),
+		    [&budget](const BudgetCompliance &c) {
+			return (c.budget == budget);
+		    });
+		if (it == compliance.end())
+			it = compliance.insert(compliance.end(),
+			    {budget, 0, 0, measured, limit});
+
+		it->calls += calls;
+		if (measured > limit)
+			++it->violations;
+		if ((measured / limit) > (it->measured / it->limit)) {
+			it->measured = measured;
+			it->limit = limit;
+		}
+	};
+	/* Call row() with the named values of each row of a CSVLog */
+	const auto readLog = [](const std::filesystem::path &path,
+	    const std::vector<std::string> &names, const auto &row) {
+		std::ifstream log{path};
+		if (!log)
+			throw std::runtime_error{"Could not open " +
+			    path.string()};
+
+		std::string line{};
+		std::getline(log, line);
+		const auto header = splitCSVLine(line);
+		std::vector<std::size_t> columns{};
+		for (const auto &name : names) {
+			const auto column = std::find(header.cbegin(),
+			    header.cend(), name);
+			if (column == header.cend())
+				throw std::runtime_error{path.string() +
+				    " has no " + name + " column"};
+			columns.push_back(static_cast<std::size_t>(
+			    std::distance(header.cbegin(), column)));
+		}
+
+		std::vector<std::string> values(names.size());
+		while (std::getline(log, line)) {
+			const auto all = splitCSVLine(line);
+			if (all.size() != header.size())
+				throw std::runtime_error{"Malformed row in " +
+				    path.string()};
+			for (std::size_t i{0}; i < columns.size(); ++i)
+				values[i] = all[columns[i]];
+			row(values);
+		}
+		if (log.bad())
+			throw std::runtime_error{"Error reading " +
+			    path.string()};
+	};
+	const auto startsWith = [](const std::string &s,
+	    const std::string &prefix) {
+		return (s.compare(0, prefix.size(), prefix) == 0);
+	};
+
+	std::vector<std::filesystem::path> logs{};
+	for (const auto &entry : std::filesystem::directory_iterator(
+	    args.outputDir)) {
+		if (!entry.is_regular_file())
+			continue;
+		if (entry.path().extension() == ".log")
+			logs.push_back(entry.path());
+		else if ((entry.path().extension() == ".bin") &&
+		    !std::filesystem::exists(std::filesystem::path(
+		    entry.path()).replace_extension(".log")))
+			skipped.push_back(entry.path().filename().string() +
+			    ": convert with --convert to check");
+	}
+	std::sort(logs.begin(), logs.end());
+
+	/* search() budget depends on the size of the reference database */
+	std::optional<uint64_t> gallerySize{};
+	const auto createLog = args.outputDir / "createReferenceDatabase.log";
+	if (std::filesystem::exists(createLog))
+		readLog(createLog, {"num_templates"},
+		    [&gallerySize](const std::vector<std::string> &values) {
+			gallerySize = std::stoull(values[0]);
+		    });
+
+	/* Sums of createTemplate() times and samples, by TemplateType */
+	std::map<std::string, std::array<double, 3>> creates{};
+	/* Sum of search() times and number of searches */
+	std::array<double, 2> searches{};
+	for (const auto &path : logs) {
+		const auto name = path.stem().string();
+		if (startsWith(name, "extractionCreate-")) {
+			readLog(path, {"elapsed", "num_images", "type"},
+			    [&creates](const std::vector<std::string> &values) {
+				auto &sums = creates[values[2] == e2i2s(
+				    TemplateType::Probe) ? "probe" :
+				    "reference"];
+				sums[0] += std::stod(values[0]);
+				sums[1] += std::stod(values[1]);
+				++sums[2];
+			    });
+		} else if (name == "createReferenceDatabase") {
+			readLog(path, {"elapsed", "num_templates"},
+			    [&check](const std::vector<std::string> &values) {
+				check("createReferenceDatabase <= 10 us x "
+				    "templates", std::stod(values[0]),
+				    static_cast<double>(
+				    CreateReferenceDatabaseBudgetPerTemplate) *
+				    std::stod(values[1]));
+			    });
+		} else if (startsWith(name, "searchCandidates")) {
+			/* One row per candidate, but one time per search */
+			std::set<std::string> identifiers{};
+			readLog(path, {"identifier", "elapsed"},
+			    [&](const std::vector<std::string> &values) {
+				if (!identifiers.insert(values[0]).second)
+					return;
+				searches[0] += std::stod(values[1]);
+				++searches[1];
+			    });
+		} else if (name == "modifyReferenceDatabase") {
+			readLog(path, {"operation", "elapsed"},
+			    [&check](const std::vector<std::string> &values) {
+				if ((values[0] != "exists") &&
+				    (values[0] != "insert") &&
+				    (values[0] != "remove"))
+					return;
+				check(values[0] + " <= 5 s",
+				    std::stod(values[1]), static_cast<double>(
+				    ModifyReferenceDatabaseBudget));
+			    });
+		} else if (name == "benchmark") {
+			readLog(path, {"gallery_size", "create_elapsed",
+			    "load_elapsed", "searches", "mean", "inserts",
+			    "insert_max"},
+			    [&check](const std::vector<std::string> &values) {
+				const double size{std::stod(values[0])};
+				check("createReferenceDatabase <= 10 us x "
+				    "templates", std::stod(values[1]),
+				    static_cast<double>(
+				    CreateReferenceDatabaseBudgetPerTemplate) *
+				    size);
+				check("SearchInterface::getImplementation <= "
+				    "5 s", std::stod(values[2]),
+				    static_cast<double>(
+				    GetSearchImplementationBudget));
+				check("search mean <= 300 us x " + values[0] +
+				    " identifiers (benchmark)",
+				    std::stod(values[4]), static_cast<double>(
+				    SearchBudgetPerIdentifier) * size,
+				    std::stoull(values[3]));
+				if (values[6] != NA)
+					check("insert <= 5 s",
+					    std::stod(values[6]),
+					    static_cast<double>(
+					    ModifyReferenceDatabaseBudget),
+					    std::stoull(values[5]));
+			    });
+		} else if (name.find("Latency") != std::string::npos) {
+			/*
+			 * getImplementation() is timed only here. Rows are the
+			 * slowest calls of each type, so the slowest (rank 1)
+			 * stands for all `count` calls.
+			 */
+			readLog(path, {"call", "rank", "elapsed", "count"},
+			    [&check](const std::vector<std::string> &values) {
+				if (values[1] != "1")
+					return;
+				if (values[0] == "ExtractionInterface::"
+				    "getImplementation")
+					check(values[0] + " <= 10 s",
+					    std::stod(values[2]),
+					    static_cast<double>(
+					    GetExtractionImplementationBudget),
+					    std::stoull(values[3]));
+				else if (values[0] == "SearchInterface::"
+				    "getImplementation")
+					check(values[0] + " <= 5 s",
+					    std::stod(values[2]),
+					    static_cast<double>(
+					    GetSearchImplementationBudget),
+					    std::stoull(values[3]));
+			    });
+		}
+	}
+
+	for (const auto &[type, sums] : creates)
+		check("createTemplate (" + type + ") mean <= 500 us x "
+		    "images", sums[0] / sums[2], static_cast<double>(
+		    CreateTemplateBudgetPerSample) * sums[1] / sums[2],
+		    static_cast<uint64_t>(sums[2]));
+	if (searches[1] > 0) {
+		if (gallerySize) {
+			check("search mean <= 300 us x " + ts(*gallerySize) +
+			    " identifiers", searches[0] / searches[1],
+			    static_cast<double>(SearchBudgetPerIdentifier *
+			    *gallerySize), static_cast<uint64_t>(searches[1]));
+
+			/* Logs don't record when searches ran between edits */
+			notes.push_back("search budget assumes the " +
+			    ts(*gallerySize) + " identifiers created");
+			if (std::filesystem::exists(args.outputDir /
+			    "modifyReferenceDatabase.log"))
+				notes.back() += ", without modifications";
+		} else
+			skipped.push_back("search: reference database size "
+			    "unknown (no createReferenceDatabase.log)");
+	}
+
+	if (compliance.empty())
+		throw std::runtime_error{"No API call times logged in " +
+		    args.outputDir.string()};
+
+	bool met{true};
+	std::cout << std::left << std::setw(52) << "Budget" << std::right <<
+	    std::setw(8) << "Calls" << std::setw(14) << "Worst (us)" <<
+	    std::setw(14) << "Limit (us)" << std::setw(10) << "Headroom" <<
+	    "  Result\n";
+	for (const auto &c : compliance) {
+		met = met && (c.violations == 0);
+		std::cout << std::left << std::setw(52) << c.budget <<
+		    std::right << std::setw(8) << c.calls << std::fixed <<
+		    std::setprecision(1) << std::setw(14) << c.measured <<
+		    std::setw(14) << c.limit << std::setw(9) <<
+		    (100 * (c.limit - c.measured) / c.limit) << "%  " <<
+		    (c.violations == 0 ? "PASS" : "FAIL (" +
+		    ts(c.violations) + ")") << '\n';
+	}
+	for (const auto &s : skipped)
+		std::cout << "Skipped " << s << '\n';
+	for (const auto &n : notes)
+		std::cout << "Note: " << n << '\n';
+
+	return (met ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+std::filesystem::path
+ELFT::Validation::convertColumnarLog(
+    const std::filesystem::path &path)
+{
+	if (path.extension() == ".log")
+		throw std::invalid_argument{"Refusing to overwrite " +
+		    path.string() + " with its conversion"};
+
+	const MappedFile file{path.string()};
+	std::size_t remaining{file.size()};
+	const std::byte *position{file.data()};
+	const auto take = [&](const std::size_t size) -> const std::byte* {
+		if (size > remaining)
+			throw std::runtime_error{path.string() + " is "
+			    "truncated"};
+		const std::byte *taken{position};
+		position += size;
+		remaining -= size;
+		return (taken);
+	};
+	const auto read = [&](auto &value) {
+		std::memcpy(&value, take(sizeof(value)), sizeof(value));
+	};
+
+	char magic[sizeof(ColumnarLog::Magic)]{};
+	read(magic);
+	uint32_t version{}, numColumns{};
+	read(version);
+	read(numColumns);
+	if (!std::equal(std::cbegin(magic), std::cend(magic),
+	    std::cbegin(ColumnarLog::Magic)) ||
+	    (version != ColumnarLog::Version) || (numColumns == 0))
+		throw std::runtime_error{path.string() + " is not a "
+		    "ColumnarLog"};
+
+	std::vector<Log::Column> columns(numColumns);
+	for (auto &column : columns) {
+		uint8_t type{};
+		uint16_t nameLength{};
+		read(type);
+		read(column.width);
+		read(nameLength);
+		column.name.assign(reinterpret_cast<const char*>(
+		    take(nameLength)), nameLength);
+
+		column.type = static_cast<Log::Type>(type);
+		if ((type < e2i(Log::Type::Integer)) ||
+		    (type > e2i(Log::Type::Tuples)) || (column.width == 0))
+			throw std::runtime_error{path.string() + " has an "
+			    "invalid column (" + column.name + ")"};
+	}
+
+	auto csvPath = path;
+	csvPath.replace_extension(".log");
+	CSVLog csv{csvPath, columns};
+
+	std::vector<const std::byte*> present(numColumns), values(numColumns);
+	while (remaining > 0) {
+		uint32_t rows{}, heapSize{};
+		read(rows);
+		read(heapSize);
+		for (uint32_t c{0}; c < numColumns; ++c) {
+			present[c] = take((rows + 7u) / 8u);
+			values[c] = take(static_cast<std::size_t>(rows) *
+			    sizeof(uint64_t));
+		}
+		const std::byte *heap{take(heapSize)};
+
+		for (uint32_t r{0}; r < rows; ++r) {
+			for (uint32_t c{0}; c < numColumns; ++c) {
+				if ((std::to_integer<uint8_t>(
+				    present[c][r / 8u]) & (1u << (r % 8u))) ==
+				    0) {
+					csv.na();
+					continue;
+				}
+
+				uint64_t value{};
+				std::memcpy(&value, values[c] +
+				    (r * sizeof(uint64_t)), sizeof(value));
+				if (columns[c].type == Log::Type::Integer) {
+					csv.integer(static_cast<int64_t>(
+					    value));
+					continue;
+				} else if (columns[c].type ==
+				    Log::Type::Real) {
+					double real{};
+					std::memcpy(&real, &value,
+					    sizeof(real));
+					csv.real(real);
+					continue;
+				}
+
+				/* Remaining types are stored in the heap */
+				const uint64_t offset{value & UINT32_MAX};
+				const uint64_t length{value >> 32};
+				if ((offset + length) > heapSize)
+					throw std::runtime_error{path.string() +
+					    " has an invalid value"};
+				if (columns[c].type == Log::Type::Tuples) {
+					if ((length % sizeof(int64_t)) != 0)
+						throw std::runtime_error{
+						    path.string() + " has an "
+						    "invalid value"};
+					std::vector<int64_t> tuples(length /
+					    sizeof(int64_t));
+					if (length > 0)
+						std::memcpy(tuples.data(),
+						    heap + offset, length);
+					csv.tuples(tuples, columns[c].width);
+				} else {
+					const std::string string(
+					    reinterpret_cast<const char*>(
+					    heap + offset), length);
+					if (columns[c].type ==
+					    Log::Type::QuotedString)
+						csv.quoted(string);
+					else
+						csv.string(string);
+				}
+			}
+		}
+	}
+	csv.flush();
+
+	return (csvPath);
+}
+
 int
 ELFT::Validation::dispatchOperation(
     const ELFT::Validation::Arguments &args)
@@ -81,9 +478,10 @@ ELFT::Validation::dispatchOperation(
 		break;
 	case Operation::CreateReferenceDatabase:
 		try {
-			const auto impl = ELFT::ExtractionInterface::
-			    getImplementation(args.configDir);
-			rv = runCreateReferenceDatabase(impl, args);
+			Latencies latencies{};
+			const auto impl = getExtractionImplementation(args,
+			    latencies);
+			rv = runCreateReferenceDatabase(impl, latencies, args);
 		} catch (const std::exception &e) {
 			std::cerr << "CreateReferenceDatabase: " << e.what() <<
 			    '\n';
@@ -94,9 +492,10 @@ ELFT::Validation::dispatchOperation(
 		break;
 	case Operation::ModifyReferenceDatabase:
 		try {
-			const auto impl = ELFT::SearchInterface::
-			    getImplementation(args.configDir, args.dbDir);
-			runModifyReferenceDatabase(impl, args);
+			Latencies latencies{};
+			const auto impl = getSearchImplementation(args,
+			    latencies);
+			runModifyReferenceDatabase(impl, latencies, args);
 			rv = EXIT_SUCCESS;
 		} catch (const std::exception &e) {
 			std::cerr << "ModifyReferenceDatabase: " << e.what() <<
@@ -116,11 +515,53 @@ ELFT::Validation::dispatchOperation(
 			std::cerr << "Search: Non-standard exception\n";
 		}
 		break;
+	case Operation::ConvertLog:
+		try {
+			convertColumnarLog(args.logPath);
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "ConvertLog: " << e.what() << '\n';
+		} catch (...) {
+			std::cerr << "ConvertLog: Non-standard exception\n";
+		}
+		break;
+	case Operation::Benchmark:
+		try {
+			rv = runBenchmark(args);
+		} catch (const std::exception &e) {
+			std::cerr << "Benchmark: " << e.what() << '\n';
+		} catch (...) {
+			std::cerr << "Benchmark: Non-standard exception\n";
+		}
+		break;
+	case Operation::CheckBudgets:
+		try {
+			rv = checkBudgets(args);
+		} catch (const std::exception &e) {
+			std::cerr << "CheckBudgets: " << e.what() << '\n';
+		} catch (...) {
+			std::cerr << "CheckBudgets: Non-standard exception\n";
+		}
+		break;
 	}
 
 	return (rv);
 }
 
+std::shared_ptr<ELFT::ExtractionInterface>
+ELFT::Validation::getExtractionImplementation(
+    const Arguments &args,
+    Latencies &latencies)
+{
+	const auto start = std::chrono::steady_clock::now();
+	auto impl = ExtractionInterface::getImplementation(args.configDir);
+	const auto stop = std::chrono::steady_clock::now();
+	latencies.record(Latencies::Call::GetExtractionImplementation, start,
+	    stop, args.configDir.string());
+
+	return (impl);
+}
+
 std::string
 ELFT::Validation::getExtractionInterfaceIdentificationString(
     const Arguments &args)
@@ -210,20 +651,37 @@ ELFT::Validation::getExtractionInterfaceIdentificationString(
 	return (ss.str());
 }
 
-const ELFT::Validation::Data::ImageSet&
+ELFT::Validation::Data::ImageSet
 ELFT::Validation::getImageSet(
+    const Arguments &args,
     const uint64_t imageIndex,
     const TemplateType templateType)
 {
-	switch(templateType) {
-	case TemplateType::Probe:
-		return Data::Latents.at(imageIndex);
-	case TemplateType::Reference:
-		return Data::References.at(imageIndex);
-	default:
-		throw std::runtime_error{"getImageSet() called with unknown "
-		    "TemplateType"};
-	}
+	return (getManifest(args).getImageSet(templateType, imageIndex));
+}
+
+const ELFT::Validation::Manifest&
+ELFT::Validation::getManifest(
+    const Arguments &args)
+{
+	/* Read once, before forking, and shared by all threads */
+	static const Manifest manifest{args.manifestPath};
+	return (manifest);
+}
+
+std::shared_ptr<ELFT::SearchInterface>
+ELFT::Validation::getSearchImplementation(
+    const Arguments &args,
+    Latencies &latencies)
+{
+	const auto start = std::chrono::steady_clock::now();
+	auto impl = SearchInterface::getImplementation(args.configDir,
+	    args.dbDir);
+	const auto stop = std::chrono::steady_clock::now();
+	latencies.record(Latencies::Call::GetSearchImplementation, start,
+	    stop, args.dbDir.string());
+
+	return (impl);
 }
 
 std::string
@@ -279,14 +737,18 @@ ELFT::Validation::getUsageString(
 	ss << '\n';
 
 	ss << prefix << "# createTemplate() + extractTemplateData()\n" <<
-	    prefix << "-e <probe|reference> -z <configDir> [-o <outputDir>] "
-	   "[-a image_dir]\n" << prefix << "[-r random_seed] [-f num_procs]\n";
+	    prefix << "-e <probe|reference> -z <configDir> "
+	    "[-o <outputDir>]\n" << prefix << "[-a image_dir] "
+	    "[--manifest manifest] [-r random_seed]\n" <<
+	    prefix << "[-f num_procs | --threads num_threads]\n" << prefix <<
+	   "[--columnar-logs] [--counters] [--resource-usage]\n";
 
 	ss << '\n';
 
 	ss << prefix << "# createReferenceDatabase()\n" << prefix <<
 	    "-c -d <referenceDir> -z <configDir> [-o <outputDir>] "
-	    "[-m max_size]\n";
+	    "[-m max_size]\n" << prefix << "[--columnar-logs] [--counters] "
+	    "[--resource-usage]\n";
 
 	ss << '\n';
 
@@ -298,30 +760,174 @@ ELFT::Validation::getUsageString(
 	ss << prefix << "# search() + extractCorrespondence()\n" << prefix <<
 	    "-s -d <referenceDir> -z <configDir> [-o <outputDir>] "
 	    "[-r random_seed]\n" << prefix <<
-	    "[-m max_candidates] [-f num_procs]\n";
+	    "[-m max_candidates] [--manifest manifest]\n" << prefix <<
+	    "[-f num_procs | --threads num_threads]\n" << prefix <<
+	    "[--columnar-logs] [--counters] [--resource-usage]\n";
+
+	ss << '\n';
+
+	ss << prefix << "# search() throughput across gallery sizes\n" <<
+	    prefix << "-b -d <referenceDir> -z <configDir> [-o <outputDir>] "
+	    "[-r random_seed]\n" << prefix << "[-m max_candidates] "
+	    "[--gallery-sizes n,n,...] [--warmup n]\n" << prefix <<
+	    "[--searches n] [--inserts n] [--synthetic]\n";
+
+	ss << '\n';
+
+	ss << prefix << "# Convert --columnar-logs output to CSV\n" << prefix <<
+	    "--convert <log.bin>\n";
+
+	ss << '\n';
+
+	ss << prefix << "# Compare logged API call times to elft.h budgets\n" <<
+	    prefix << "--check-budgets [-o <outputDir>]\n";
 
 	ss << '\n';
 
 	ss << prefix << "# Database modification operations\n" << prefix <<
-	    "-t -d <referenceDir> -z <configDir> [-o <outputDir>]";
+	    "-t -d <referenceDir> -z <configDir> [-o <outputDir>]\n" <<
+	    prefix << "[--manifest manifest]\n" << prefix <<
+	    "[--columnar-logs] [--counters] [--resource-usage]\n";
+
+	ss << '\n';
+
+	ss << prefix << "# --resource-usage excludes the CPU time and "
+	    "allocations of the\n" << prefix << "# driver's loader and log "
+	    "threads, but not their faults or RSS.\n" << prefix << "# All "
+	    "are NA with --threads, as calls overlap. --counters only\n" <<
+	    prefix << "# counts the thread calling the implementation, so "
+	    "it is NA\n" << prefix << "# once the implementation starts "
+	    "threads of its own.";
 
 	return (ss.str());
 }
 
+std::string
+ELFT::Validation::getWorkerName(
+    const pid_t pid,
+    const std::optional<uint8_t> thread)
+{
+	if (thread)
+		return (ts(pid) + '-' + ts(*thread));
+	return (ts(pid));
+}
+
+void
+ELFT::Validation::mergeLogs(
+    const Arguments &args,
+    const std::string &prefix,
+    const std::vector<std::string> &workerNames,
+    const std::vector<std::string> &identifiers)
+{
+	std::string header{};
+	std::unordered_map<std::string, std::string> linesByIdentifier{};
+	for (const auto &workerName : workerNames) {
+		const auto path = args.outputDir /
+		    (prefix + '-' + workerName + ".log");
+		std::ifstream workerLog{path};
+		if (!workerLog)
+			throw std::runtime_error{"Could not open " +
+			    path.string()};
+
+		/* Header is identical in each log */
+		std::getline(workerLog, header);
+
+		std::string line{};
+		while (std::getline(workerLog, line)) {
+			auto &lines = linesByIdentifier[line.substr(0,
+			    line.find(','))];
+			lines += line;
+			lines += '\n';
+		}
+		if (workerLog.bad())
+			throw std::runtime_error{"Error reading " +
+			    path.string()};
+	}
+
+	const auto path = args.outputDir / (prefix + ".log");
+	std::ofstream log{path};
+	if (!log)
+		throw std::runtime_error{"Could not create " + path.string()};
+	log << header << '\n';
+	for (const auto &identifier : identifiers) {
+		const auto lines = linesByIdentifier.find(identifier);
+		if (lines == linesByIdentifier.cend())
+			continue;
+		log << lines->second;
+		linesByIdentifier.erase(lines);
+	}
+	/* Should be none, but don't lose anything unexpected */
+	for (const auto &[identifier, lines] : linesByIdentifier)
+		log << lines;
+	if (!log.flush())
+		throw std::runtime_error{"Error writing " + path.string()};
+
+	for (const auto &workerName : workerNames)
+		std::filesystem::remove(args.outputDir /
+		    (prefix + '-' + workerName + ".log"));
+}
+
+std::unique_ptr<ELFT::Validation::Log>
+ELFT::Validation::openLog(
+    const Arguments &args,
+    const std::string &name,
+    const std::vector<Log::Column> &columns)
+{
+	auto allColumns = args.hardwareCounters ?
+	    HardwareCounters::addColumns(columns) : columns;
+	if (args.resourceUsage)
+		allColumns = ResourceUsage::addColumns(allColumns);
+	if (args.columnarLogs)
+		return (std::make_unique<ColumnarLog>(args.outputDir /
+		    (name + ".bin"), allColumns));
+	return (std::make_unique<CSVLog>(args.outputDir / (name + ".log"),
+	    allColumns));
+}
+
 ELFT::Validation::Arguments
 ELFT::Validation::parseArguments(
     const int argc,
     char * const argv[])
 {
-	static const char options[] {"a:cd:e:f:ijm:o:r:stz:"};
+	static const char options[] {"a:bcd:e:f:ijm:o:r:stz:"};
+	/* Long-only options use values outside the range of short options */
+	enum LongOption : int {Threads = 256, ColumnarLogs, Convert, Counters,
+	    Resources, GallerySizes, Warmup, Searches, Inserts, Synthetic,
+	    CheckBudgets, ManifestPath};
+	static const struct option longOptions[] {
+	    {"threads", required_argument, nullptr, LongOption::Threads},
+	    {"columnar-logs", no_argument, nullptr, LongOption::ColumnarLogs},
+	    {"convert", required_argument, nullptr, LongOption::Convert},
+	    {"counters", no_argument, nullptr, LongOption::Counters},
+	    {"resource-usage", no_argument, nullptr,
+		LongOption::Resources},
+	    {"gallery-sizes", required_argument, nullptr,
+		LongOption::GallerySizes},
+	    {"warmup", required_argument, nullptr, LongOption::Warmup},
+	    {"searches", required_argument, nullptr, LongOption::Searches},
+	    {"inserts", required_argument, nullptr, LongOption::Inserts},
+	    {"synthetic", no_argument, nullptr, LongOption::Synthetic},
+	    {"check-budgets", no_argument, nullptr,
+		LongOption::CheckBudgets},
+	    {"manifest", required_argument, nullptr,
+		LongOption::ManifestPath},
+	    {nullptr, 0, nullptr, 0}
+	};
 	Validation::Arguments args{};
 
 	int c{};
-	while ((c = getopt(argc, argv, options)) != -1) {
+	while ((c = getopt_long(argc, argv, options, longOptions,
+	    nullptr)) != -1) {
 		switch (c) {
 		case 'a':	/* Image directory */
 			args.imageDir = optarg;
 			break;
+		case 'b':	/* Benchmark */
+			if (args.operation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			args.operation = Operation::Benchmark;
+			break;
 		case 'c':	/* Create reference database */
 			if (args.operation)
 				throw std::logic_error{"Multiple operations "
@@ -420,13 +1026,115 @@ ELFT::Validation::parseArguments(
 		case 'z':	/* Config dir */
 			args.configDir = optarg;
 			break;
+		case LongOption::Threads: {	/* Number of threads */
+			unsigned long numThreads{};
+			try {
+				numThreads = std::stoul(optarg);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Number of "
+				    "threads (--threads): an error occurred "
+				    "when parsing \"" + std::string(optarg) +
+				    "\""};
+			}
+			if ((numThreads == 0) || (numThreads > UINT8_MAX))
+				throw std::invalid_argument{"Number of "
+				    "threads (--threads) must be between 1 "
+				    "and " + ts(UINT8_MAX)};
+			args.numThreads = static_cast<uint8_t>(numThreads);
+			break;
+		}
+		case LongOption::ColumnarLogs:	/* Binary logs */
+			args.columnarLogs = true;
+			break;
+		case LongOption::Convert:	/* ColumnarLog to CSV */
+			if (args.operation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			args.operation = Operation::ConvertLog;
+			args.logPath = optarg;
+			break;
+		case LongOption::Counters:	/* Hardware counters */
+			args.hardwareCounters = true;
+			break;
+		case LongOption::Resources:	/* CPU and memory */
+			args.resourceUsage = true;
+			break;
+		case LongOption::GallerySizes: {	/* Benchmark sizes */
+			std::stringstream sizes{optarg};
+			std::string size{};
+			while (std::getline(sizes, size, ',')) {
+				uint64_t gallerySize{};
+				try {
+					gallerySize = std::stoull(size);
+				} catch (const std::exception&) {
+					throw std::invalid_argument{"Gallery "
+					    "sizes (--gallery-sizes): an error "
+					    "occurred when parsing \"" + size +
+					    "\""};
+				}
+				if (gallerySize == 0)
+					throw std::invalid_argument{"Gallery "
+					    "sizes (--gallery-sizes) must be "
+					    "greater than 0"};
+				args.gallerySizes.push_back(gallerySize);
+			}
+			break;
+		}
+		case LongOption::Warmup:	/* Untimed searches */
+			try {
+				args.warmupSearches = std::stoull(optarg);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Warmup searches "
+				    "(--warmup): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+			break;
+		case LongOption::Searches:	/* Timed searches */
+			try {
+				args.benchmarkSearches = std::stoull(optarg);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Timed searches "
+				    "(--searches): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+			if (args.benchmarkSearches == 0)
+				throw std::invalid_argument{"Timed searches "
+				    "(--searches) must be greater than 0"};
+			break;
+		case LongOption::Inserts:	/* Timed insertions */
+			try {
+				args.benchmarkInserts = std::stoull(optarg);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Timed insertions "
+				    "(--inserts): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+			break;
+		case LongOption::Synthetic:	/* SyntheticGallery */
+			args.syntheticGallery = true;
+			break;
+		case LongOption::CheckBudgets:	/* Budget compliance */
+			if (args.operation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			args.operation = Operation::CheckBudgets;
+			break;
+		case LongOption::ManifestPath:	/* Dataset */
+			args.manifestPath = optarg;
+			break;
 		}
 	}
 
+	if ((args.numProcs > 1) && (args.numThreads > 1))
+		throw std::invalid_argument{"Number of processes (-f) and "
+		    "number of threads (--threads) are mutually exclusive"};
+
 	if (!args.operation)
 		args.operation = Operation::Usage;
 
-	if (args.configDir.empty() && (args.operation != Operation::Usage))
+	if (args.configDir.empty() && (args.operation != Operation::Usage) &&
+	    (args.operation != Operation::ConvertLog) &&
+	    (args.operation != Operation::CheckBudgets))
 		throw std::invalid_argument{"Must provide path to "
 		     "configuration directory"};
 
@@ -434,16 +1142,19 @@ ELFT::Validation::parseArguments(
 	    (args.operation == Operation::IdentifySearch) ||
 	    (args.operation == Operation::CreateReferenceDatabase) ||
 	    (args.operation == Operation::ModifyReferenceDatabase) ||
-	    (args.operation == Operation::Search)))
+	    (args.operation == Operation::Search) ||
+	    (args.operation == Operation::Benchmark)))
 		throw std::invalid_argument{"Must provide path to reference "
 		    "database"};
 
 	if (args.maximum == 0) {
 		if (args.operation == Operation::CreateReferenceDatabase)
 			args.maximum = 100000000;
-		else if (args.operation == Operation::Search)
+		else if ((args.operation == Operation::Search) ||
+		    (args.operation == Operation::Benchmark))
 			args.maximum = 100;
-	} else if (args.operation == Operation::Search) {
+	} else if ((args.operation == Operation::Search) ||
+	    (args.operation == Operation::Benchmark)) {
 		if (args.maximum > UINT16_MAX)
 			throw std::invalid_argument{"Maximum number of "
 			    "candidates (-m) is " + ts(UINT16_MAX)};
@@ -474,27 +1185,366 @@ std::vector<std::byte>
 ELFT::Validation::readFile(
     const std::string &pathName)
 {
-	std::ifstream file{pathName,
-	    std::ifstream::ate | std::ifstream::binary};
-	if (!file)
+	const int fd = ::open(pathName.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
 		throw std::runtime_error{"Could not open " + pathName};
-	file.unsetf(std::ifstream::skipws);
 
-	const auto size = file.tellg();
-	if (size == -1)
+	struct stat sb{};
+	if (::fstat(fd, &sb) != 0) {
+		::close(fd);
 		throw std::runtime_error{"Could not open " + pathName};
+	}
 
-	std::vector<std::byte> buf{};
-	buf.resize(static_cast<std::vector<std::byte>::size_type>(size));
-	file.seekg(std::ifstream::beg);
-	file.read(reinterpret_cast<char*>(buf.data()), size);
+	/* Read directly into the result, with no intermediate copy */
+	std::vector<std::byte> buf(static_cast<std::size_t>(sb.st_size));
+	std::size_t offset{};
+	while (offset < buf.size()) {
+		const auto got = ::read(fd, buf.data() + offset,
+		    buf.size() - offset);
+		if ((got == -1) && (errno == EINTR))
+			continue;
+		if (got <= 0) {
+			::close(fd);
+			throw std::runtime_error{"Could not read " + pathName};
+		}
+		offset += static_cast<std::size_t>(got);
+	}
+	::close(fd);
 
 	return (buf);
 }
 
+ELFT::Validation::Samples
+ELFT::Validation::readSamples(
+    const uint64_t imageIndex,
+    const Arguments &args)
+{
+	const auto mds = getImageSet(args, imageIndex,
+	    *args.templateType).second;
+	Samples samples{};
+	for (std::vector<Data::ImageMetadata>::size_type i{}; i < mds.size();
+	    ++i) {
+		const auto &md = mds.at(i);
+
+		if (!md.filename && !md.efs)
+			throw std::runtime_error("No filename or EFS data "
+			    "provided for imageIndex = " + ts(imageIndex));
+
+		if (md.filename) {
+			if (!md.width || !md.height || !md.ppi || !md.bpc ||
+			    !md.bpp)
+				throw std::runtime_error("Missing image meta"
+				    "data for imageIndex = " + ts(imageIndex));
+
+			if (md.efs && (md.efs->identifier != i))
+				throw std::runtime_error("ID != for Image and "
+				    "EFS for imageIndex = " + ts(imageIndex));
+
+			samples.emplace_back(Image(static_cast<uint8_t>(i),
+			    *md.width, *md.height, *md.ppi, *md.bpc, *md.bpp,
+			    readFile(args.imageDir / *md.filename)), md.efs);
+		} else
+			samples.emplace_back(std::nullopt, md.efs);
+	}
+
+	return (samples);
+}
+
+std::vector<std::vector<std::byte>>
+ELFT::Validation::readTemplates(
+    const std::filesystem::path &dir)
+{
+	std::vector<std::filesystem::path> paths{};
+	for (const auto &tmpl : std::filesystem::recursive_directory_iterator(
+	    dir)) {
+		/* Empty templates were written when creation failed */
+		if ((tmpl.path().extension() != Data::TemplateSuffix) ||
+		    !tmpl.is_regular_file() || (tmpl.file_size() == 0))
+			continue;
+		paths.push_back(tmpl.path());
+	}
+	std::sort(paths.begin(), paths.end());
+
+	std::vector<std::vector<std::byte>> templates{};
+	templates.reserve(paths.size());
+	for (const auto &path : paths)
+		templates.push_back(readFile(path));
+	return (templates);
+}
+
+int
+ELFT::Validation::runBenchmark(
+    const Arguments &args)
+{
+	const auto probes = readTemplates(args.outputDir /
+	    Data::LatentTemplateDir);
+	if (probes.empty())
+		throw std::runtime_error{"No probe templates to search in " +
+		    args.outputDir.string() + " (run -e probe first)"};
+
+	std::vector<std::vector<std::byte>> references{};
+	if (!args.syntheticGallery) {
+		references = readTemplates(args.outputDir /
+		    Data::ReferenceTemplateDir);
+		if (references.empty())
+			throw std::runtime_error{"No reference templates to "
+			    "search in " + args.outputDir.string() + " (run "
+			    "-e reference first, or use --synthetic)"};
+
+		/* Galleries share one random order, so smaller ones nest */
+		std::shuffle(references.begin(), references.end(),
+		    std::mt19937_64(args.randomSeed));
+	}
+
+	auto gallerySizes = args.gallerySizes;
+	if (gallerySizes.empty()) {
+		if (args.syntheticGallery) {
+			gallerySizes = {1000, 10000, 100000};
+		} else {
+			/* Powers of 10, then every template */
+			for (uint64_t size{10}; size < references.size();
+			    size *= 10)
+				gallerySizes.push_back(size);
+			gallerySizes.push_back(references.size());
+		}
+	}
+	std::sort(gallerySizes.begin(), gallerySizes.end());
+	gallerySizes.erase(std::unique(gallerySizes.begin(),
+	    gallerySizes.end()), gallerySizes.end());
+	if (!args.syntheticGallery &&
+	    (gallerySizes.back() > references.size()))
+		throw std::invalid_argument{"Gallery size " +
+		    ts(gallerySizes.back()) + " is larger than the " +
+		    ts(references.size()) + " reference templates in " +
+		    args.outputDir.string() + " (use --synthetic)"};
+
+	static const std::vector<Log::Column> columns{
+	    {"gallery_size", Log::Type::Integer},
+	    {"create_elapsed", Log::Type::Integer},
+	    {"load_elapsed", Log::Type::Integer},
+	    {"searches", Log::Type::Integer},
+	    {"failures", Log::Type::Integer},
+	    {"searches_per_second", Log::Type::Real},
+	    {"mean", Log::Type::Real},
+	    {"p50", Log::Type::Integer},
+	    {"p90", Log::Type::Integer},
+	    {"p99", Log::Type::Integer},
+	    {"max", Log::Type::Integer},
+	    {"budget", Log::Type::Integer},
+	    {"within_budget", Log::Type::Integer},
+	    {"inserts", Log::Type::Integer},
+	    {"insert_failures", Log::Type::Integer},
+	    {"insert_mean", Log::Type::Real},
+	    {"insert_max", Log::Type::Integer}};
+	CSVLog log{args.outputDir / "benchmark.log", columns};
+
+	const auto impl = ExtractionInterface::getImplementation(
+	    args.configDir);
+	const SyntheticGallery synthetic{impl, args.randomSeed};
+	std::vector<BenchmarkResult> results{};
+	bool withinBudget{true};
+	for (const auto gallerySize : gallerySizes) {
+		/* Synthetic galleries also nest, growing as needed */
+		if (args.syntheticGallery) {
+			references.reserve(gallerySize);
+			while (references.size() < gallerySize)
+				references.push_back(synthetic.createTemplate(
+				    references.size()));
+		}
+
+		const auto result = runBenchmarkGallery(impl, references,
+		    probes, gallerySize, synthetic, args);
+		results.push_back(result);
+
+		const uint64_t budget{SearchBudgetPerIdentifier * gallerySize};
+		const bool within{result.mean <= static_cast<double>(budget)};
+		withinBudget = withinBudget && within;
+
+		log.integer(result.gallerySize).integer(result.createElapsed).
+		    integer(result.loadElapsed).integer(result.searches).
+		    integer(result.failures).real(result.searchesPerSecond).
+		    real(result.mean).integer(result.p50).integer(result.p90).
+		    integer(result.p99).integer(result.max).integer(budget).
+		    integer(within ? 1 : 0).integer(result.inserts).
+		    integer(result.insertFailures);
+		if (result.inserts > 0)
+			log.real(result.insertMean).integer(result.insertMax);
+		else
+			log.na(2);
+	}
+	log.flush();
+
+	/* Least squares fit of mean search time = intercept + slope * N */
+	double meanSize{0}, meanTime{0};
+	for (const auto &result : results) {
+		meanSize += static_cast<double>(result.gallerySize);
+		meanTime += result.mean;
+	}
+	meanSize /= static_cast<double>(results.size());
+	meanTime /= static_cast<double>(results.size());
+
+	double sxx{0}, sxy{0}, syy{0};
+	for (const auto &result : results) {
+		const double dx{static_cast<double>(result.gallerySize) -
+		    meanSize};
+		const double dy{result.mean - meanTime};
+		sxx += dx * dx;
+		sxy += dx * dy;
+		syy += dy * dy;
+	}
+
+	static const std::vector<Log::Column> fitColumns{
+	    {"num_gallery_sizes", Log::Type::Integer},
+	    {"intercept", Log::Type::Real},
+	    {"slope", Log::Type::Real},
+	    {"r_squared", Log::Type::Real},
+	    {"budget_slope", Log::Type::Integer}};
+	CSVLog fitLog{args.outputDir / "benchmarkFit.log", fitColumns};
+	fitLog.integer(results.size());
+	if (sxx > 0) {
+		const double slope{sxy / sxx};
+		fitLog.real(meanTime - (slope * meanSize)).real(slope).
+		    real(syy > 0 ? (sxy * sxy) / (sxx * syy) : 1.0);
+	} else
+		fitLog.na(3);
+	fitLog.integer(SearchBudgetPerIdentifier);
+	fitLog.flush();
+
+	return (withinBudget ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+ELFT::Validation::BenchmarkResult
+ELFT::Validation::runBenchmarkGallery(
+    std::shared_ptr<ExtractionInterface> impl,
+    const std::vector<std::vector<std::byte>> &references,
+    const std::vector<std::vector<std::byte>> &probes,
+    const uint64_t gallerySize,
+    const SyntheticGallery &synthetic,
+    const Arguments &args)
+{
+	const auto dbDir = args.dbDir / ts(gallerySize);
+	if (std::filesystem::exists(dbDir))
+		throw std::runtime_error{"Refusing to overwrite existing "
+		    "reference database " + dbDir.string()};
+	std::filesystem::create_directories(dbDir);
+	std::filesystem::permissions(dbDir,
+	    std::filesystem::perms::owner_all |
+	    std::filesystem::perms::group_all);
+
+	const std::vector<std::vector<std::byte>> gallery(references.cbegin(),
+	    std::next(references.cbegin(),
+	    static_cast<std::ptrdiff_t>(gallerySize)));
+	BenchmarkResult result{};
+	result.gallerySize = gallerySize;
+	ReturnStatus rs{};
+	try {
+		const auto maxSize = std::filesystem::space(dbDir).available;
+		const auto start = std::chrono::steady_clock::now();
+		rs = impl->createReferenceDatabase(gallery, dbDir, maxSize);
+		const auto stop = std::chrono::steady_clock::now();
+		result.createElapsed = microseconds(start, stop);
+	} catch (const std::exception &e) {
+		throw std::runtime_error{"Exception while creating reference "
+		    "database of " + ts(gallerySize) + " templates (" +
+		    std::string(e.what()) + ")"};
+	} catch (...) {
+		throw std::runtime_error{"Unknown exception while creating "
+		    "reference database of " + ts(gallerySize) + " templates"};
+	}
+	if (!rs)
+		throw std::runtime_error{"Could not create reference database "
+		    "of " + ts(gallerySize) + " templates (" +
+		    rs.message.value_or("") + ")"};
+
+	result.searches = args.benchmarkSearches;
+	result.inserts = args.benchmarkInserts;
+	const auto maxCandidates = static_cast<uint16_t>(args.maximum);
+	std::vector<int64_t> elapsed(args.benchmarkSearches);
+	std::vector<int64_t> insertElapsed(args.benchmarkInserts);
+	try {
+		const auto loadStart = std::chrono::steady_clock::now();
+		const auto search = SearchInterface::getImplementation(
+		    args.configDir, dbDir);
+		const auto loadStop = std::chrono::steady_clock::now();
+		result.loadElapsed = microseconds(loadStart, loadStop);
+
+		for (uint64_t i{0}; i < args.warmupSearches; ++i)
+			search->search(probes[i % probes.size()],
+			    maxCandidates);
+
+		/* Nothing but search() between the clock reads */
+		const auto first = std::chrono::steady_clock::now();
+		for (uint64_t i{0}; i < args.benchmarkSearches; ++i) {
+			const auto start = std::chrono::steady_clock::now();
+			const auto searchResult = search->search(
+			    probes[i % probes.size()], maxCandidates);
+			const auto stop = std::chrono::steady_clock::now();
+
+			elapsed[i] = microseconds(start, stop);
+			if (!searchResult.status)
+				++result.failures;
+		}
+		const auto last = std::chrono::steady_clock::now();
+
+		result.searchesPerSecond =
+		    static_cast<double>(args.benchmarkSearches) /
+		    std::chrono::duration<double>(last - first).count();
+
+		/* Stream identities past the gallery, one at a time */
+		for (uint64_t i{0}; i < args.benchmarkInserts; ++i) {
+			const auto index = gallerySize + i;
+			const auto referenceTemplate =
+			    synthetic.createTemplate(index);
+
+			const auto start = std::chrono::steady_clock::now();
+			const auto insertStatus = search->insert(
+			    SyntheticGallery::getIdentifier(index),
+			    referenceTemplate);
+			const auto stop = std::chrono::steady_clock::now();
+
+			insertElapsed[i] = microseconds(start, stop);
+			if (!insertStatus)
+				++result.insertFailures;
+		}
+	} catch (const std::exception &e) {
+		throw std::runtime_error{"Exception while searching reference "
+		    "database of " + ts(gallerySize) + " templates (" +
+		    std::string(e.what()) + ")"};
+	} catch (...) {
+		throw std::runtime_error{"Unknown exception while searching "
+		    "reference database of " + ts(gallerySize) + " templates"};
+	}
+
+	std::sort(elapsed.begin(), elapsed.end());
+	result.mean = static_cast<double>(std::accumulate(elapsed.cbegin(),
+	    elapsed.cend(), int64_t{0})) / static_cast<double>(
+	    elapsed.size());
+	/* Percentiles, in tenths of a percent */
+	const auto percentile = [&elapsed](const uint64_t p) -> int64_t {
+		const uint64_t rank{std::max<uint64_t>(1,
+		    ((elapsed.size() * p) + 999) / 1000)};
+		return (elapsed[rank - 1]);
+	};
+	result.p50 = percentile(500);
+	result.p90 = percentile(900);
+	result.p99 = percentile(990);
+	result.max = elapsed.back();
+
+	if (!insertElapsed.empty()) {
+		result.insertMean = static_cast<double>(std::accumulate(
+		    insertElapsed.cbegin(), insertElapsed.cend(),
+		    int64_t{0})) / static_cast<double>(insertElapsed.size());
+		result.insertMax = *std::max_element(insertElapsed.cbegin(),
+		    insertElapsed.cend());
+	}
+
+	return (result);
+}
+
 int
 ELFT::Validation::runCreateReferenceDatabase(
     std::shared_ptr<ExtractionInterface> impl,
+    Latencies &latencies,
     const Arguments &args)
 {
 	/*
@@ -508,7 +1558,6 @@ ELFT::Validation::runCreateReferenceDatabase(
 
 	/* Read in all templates */
 	std::vector<std::vector<std::byte>> referenceTemplates{};
-	referenceTemplates.reserve(Data::References.size());
 	for (const auto &tmpl : std::filesystem::recursive_directory_iterator(
 	    args.outputDir / Data::ReferenceTemplateDir)) {
 		if ((tmpl.path().extension() != Data::TemplateSuffix) ||
@@ -519,12 +1568,20 @@ ELFT::Validation::runCreateReferenceDatabase(
 	}
 
 	ReturnStatus rs{};
+	const HardwareCounters counters{args.hardwareCounters, 1};
+	const ResourceUsage usage{args.resourceUsage, false};
+	HardwareCounters::Counts before{}, after{};
+	ResourceUsage::Counts usageBefore{}, usageAfter{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
+		usageBefore = usage.read();
+		before = counters.read();
 		start = std::chrono::steady_clock::now();
 		rs = impl->createReferenceDatabase(referenceTemplates,
 		    args.dbDir, args.maximum);
 		stop = std::chrono::steady_clock::now();
+		after = counters.read();
+		usageAfter = usage.read();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while creating reference "
 		    "database (" + std::string(e.what()) + ")");
@@ -532,33 +1589,36 @@ ELFT::Validation::runCreateReferenceDatabase(
 		throw std::runtime_error("Unknown exception while creating "
 		    "reference database");
 	}
-
-	const std::string logName{"createReferenceDatabase.log"};
-	std::ofstream file{args.outputDir / logName};
-	if (!file)
-		throw std::runtime_error(ts(getpid()) + ": Error creating log "
-		    "file");
-
-	static const std::string header{"elapsed,result,\"message\",max_size,"
-	    "num_templates"};
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error("Error writing to log");
-
-	file << duration(start, stop) << ',' << e2i2s(rs.result) << ",\"" <<
-	    (rs.message ? *rs.message : "") << "\"," << ts(args.maximum) <<
-	    ',' << ts(referenceTemplates.size()) << '\n';
-	if (!file)
-		throw std::runtime_error("Error writing to log");
+	latencies.record(Latencies::Call::CreateReferenceDatabase, start,
+	    stop, args.dbDir.string());
+
+	static const std::vector<Log::Column> columns{
+	    {"elapsed", Log::Type::Integer},
+	    {"result", Log::Type::Integer},
+	    {"\"message\"", Log::Type::QuotedString},
+	    {"max_size", Log::Type::Integer},
+	    {"num_templates", Log::Type::Integer}};
+	const auto log = openLog(args, "createReferenceDatabase", columns);
+
+	log->integer(microseconds(start, stop));
+	usage.log(*log, usageBefore, usageAfter);
+	counters.log(*log, before, after);
+	log->integer(rs.result).quoted(rs.message.value_or("")).
+	    integer(args.maximum).integer(referenceTemplates.size());
+	log->flush();
+	latencies.writeSummary(args.outputDir /
+	    "createReferenceDatabaseLatency.log");
 
 	return (rs ? EXIT_SUCCESS : EXIT_FAILURE);
 }
 
-void
+std::vector<uint64_t>
 ELFT::Validation::runExtractionCreate(
     std::shared_ptr<ExtractionInterface> impl,
-    const std::vector<uint64_t> &indicies,
-    const Arguments &args)
+    WorkQueue &queue,
+    Latencies &latencies,
+    const Arguments &args,
+    const std::string &workerName)
 {
 	std::filesystem::create_directory(args.outputDir / Data::TemplateDir,
 	    args.outputDir);
@@ -568,115 +1628,138 @@ ELFT::Validation::runExtractionCreate(
 		std::filesystem::create_directory(dir,
 		    args.outputDir / Data::TemplateDir);
 
-	const std::string logName{"extractionCreate-" +
-	    e2i2s(*args.templateType) + '-' + ts(getpid()) + ".log"};
-	std::ofstream file{args.outputDir / logName};
-	if (!file)
-		throw std::runtime_error(ts(getpid()) + ": Error creating log "
-		    "file");
-
-	static const std::string header{"\"identifier\",elapsed,result,"
-	    "\"message\",type,num_images,size"};
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error(ts(getpid()) + ": Error writing to "
-		    "log");
-
-	for (const auto &n : indicies) {
-		file << performSingleCreate(impl, n, args) << '\n';
-		if (!file)
-			throw std::runtime_error(ts(getpid()) + ": Error "
-			    "writing to log");
+	static const std::vector<Log::Column> columns{
+	    {"\"identifier\"", Log::Type::QuotedString},
+	    {"elapsed", Log::Type::Integer},
+	    {"result", Log::Type::Integer},
+	    {"\"message\"", Log::Type::QuotedString},
+	    {"type", Log::Type::Integer},
+	    {"num_images", Log::Type::Integer},
+	    {"size", Log::Type::Integer}};
+	const auto log = openLog(args, "extractionCreate-" +
+	    e2i2s(*args.templateType) + '-' + workerName, columns);
+	/* The main thread, and any --threads workers */
+	const HardwareCounters counters{args.hardwareCounters,
+	    (args.numThreads > 1) ? (args.numThreads + 1u) : 1u};
+	const ResourceUsage usage{args.resourceUsage, args.numThreads > 1};
+
+	/* Read upcoming images while templates are being created */
+	std::vector<uint64_t> claimed{};
+	SampleLoader loader{queue, args};
+	for (auto entry = loader.next(); entry; entry = loader.next()) {
+		performSingleCreate(impl, entry->index, entry->samples, args,
+		    *log, latencies, counters, usage);
+		claimed.push_back(entry->index);
 	}
+	log->flush();
+
+	return (claimed);
 }
 
 void
 ELFT::Validation::runExtractionExtractData(
     std::shared_ptr<ExtractionInterface> impl,
     const std::vector<uint64_t> &indicies,
-    const Arguments &args)
-
+    Latencies &latencies,
+    const Arguments &args,
+    const std::string &workerName)
 {
-	static const std::string header{"\"template_filename\",elapsed,"
-	    "type,index,num_templates_in_buffer,image_identifier,quality,"
-	    "imp,frct,frgp,orientation,lpm,value_assessment,lsb,pat,plr,trv,"
-	    "cores,deltas,minutia,roi"};
-
-	const std::string logName{"extractionData-" +
-	    e2i2s(*args.templateType) + '-' + ts(getpid()) + ".log"};
-	std::ofstream file{args.outputDir / logName};
-	if (!file)
-		throw std::runtime_error(ts(getpid()) + ": Error creating log "
-		    "file");
-
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error(ts(getpid()) + ": Error writing to "
-		    "log");
+	static const std::vector<Log::Column> columns{
+	    {"\"template_filename\"", Log::Type::QuotedString},
+	    {"elapsed", Log::Type::Integer},
+	    {"type", Log::Type::Integer},
+	    {"index", Log::Type::Integer},
+	    {"num_templates_in_buffer", Log::Type::Integer},
+	    {"image_identifier", Log::Type::Integer},
+	    {"quality", Log::Type::Integer},
+	    {"imp", Log::Type::Integer},
+	    {"frct", Log::Type::Integer},
+	    {"frgp", Log::Type::Integer},
+	    {"orientation", Log::Type::Integer},
+	    {"lpm", Log::Type::Tuples, 1},
+	    {"value_assessment", Log::Type::Integer},
+	    {"lsb", Log::Type::Integer},
+	    {"pat", Log::Type::Integer},
+	    {"plr", Log::Type::Integer},
+	    {"trv", Log::Type::Integer},
+	    {"cores", Log::Type::Tuples, 2},
+	    {"deltas", Log::Type::Tuples, 2},
+	    {"minutia", Log::Type::Tuples, 4},
+	    {"roi", Log::Type::Tuples, 2}};
+	const auto log = openLog(args, "extractionData-" +
+	    e2i2s(*args.templateType) + '-' + workerName, columns);
+	/* The main thread, and any --threads workers */
+	const HardwareCounters counters{args.hardwareCounters,
+	    (args.numThreads > 1) ? (args.numThreads + 1u) : 1u};
+	const ResourceUsage usage{args.resourceUsage, args.numThreads > 1};
 
 	for (const auto &n : indicies) {
-		std::string id{};
-		std::tie(id, std::ignore) = getImageSet(n, *args.templateType);
+		const auto id = getManifest(args).getIdentifier(
+		    *args.templateType, n);
 
 		const std::filesystem::path f{
 		    args.outputDir / Data::getTemplateDir(*args.templateType) /
 		    std::string(id + Data::TemplateSuffix)};
-		file << performSingleExtractData(impl, *args.templateType, f) <<
-		    '\n';
+		performSingleExtractData(impl, *args.templateType, f, *log,
+		    latencies, counters, usage);
 	}
+
+	log->flush();
 }
 
 void
 ELFT::Validation::runModifyReferenceDatabase(
     std::shared_ptr<SearchInterface> impl,
+    Latencies &latencies,
     const Arguments &args)
 {
-	const std::string logName{"modifyReferenceDatabase.log"};
-	std::ofstream file{args.outputDir / logName};
-	if (!file)
-		throw std::runtime_error{"Error creating modify reference "
-		    "database log file"};
-	static const std::string header{"\"identifier\",\"operation\",elapsed,"
-	    "result,\"message\",operation_succeeded"};
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error{"Error writing to log"};
+	const HardwareCounters counters{args.hardwareCounters, 1};
+	const ResourceUsage usage{args.resourceUsage, false};
+
+	static const std::vector<Log::Column> columns{
+	    {"\"identifier\"", Log::Type::QuotedString},
+	    {"\"operation\"", Log::Type::QuotedString},
+	    {"elapsed", Log::Type::Integer},
+	    {"result", Log::Type::Integer},
+	    {"\"message\"", Log::Type::QuotedString},
+	    {"operation_succeeded", Log::Type::Integer}};
+	const auto log = openLog(args, "modifyReferenceDatabase", columns);
 
 	/* Find the first reference template that exists */
 	std::string identifier{};
 	std::vector<std::byte> refTemplate{};
-	for (const auto &ref : Data::References) {
-		std::tie(identifier, std::ignore) = ref;
-		file << "\"" << identifier << "\",\"read_from_disk\"," << NA <<
-		    ',';
-		if (!file)
-			throw std::runtime_error{"Error writing to log"};
+	const auto &manifest = getManifest(args);
+	for (uint64_t i{}; i < manifest.size(TemplateType::Reference); ++i) {
+		identifier = manifest.getIdentifier(TemplateType::Reference, i);
+		log->quoted(identifier).quoted("read_from_disk").na();
+		usage.log(*log, {}, {});
+		counters.log(*log, {}, {});
 
 		/* Read template from disk */
 		try {
 			refTemplate = readFile(args.outputDir /
 			    Data::ReferenceTemplateDir /
 			    (identifier + Data::TemplateSuffix));
-			file << "0," << NA << ",1\n";
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
 		} catch (...) {
-			file << "1," << NA << ",0\n";
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
+			log->integer(1).na().integer(0);
 			continue;
 		}
+		log->integer(0).na().integer(1);
 
 		/* Make sure it's also in the reference database */
 		bool exists{};
 		ReturnStatus rs{};
+		HardwareCounters::Counts before{}, after{};
+		ResourceUsage::Counts usageBefore{}, usageAfter{};
 		std::chrono::steady_clock::time_point start{}, stop{};
 		try {
+			usageBefore = usage.read();
+			before = counters.read();
 			start = std::chrono::steady_clock::now();
 			std::tie(rs, exists) = impl->exists(identifier);
 			stop = std::chrono::steady_clock::now();
+			after = counters.read();
+			usageAfter = usage.read();
 		} catch (const std::exception &e) {
 			throw std::runtime_error{"Exception while checking "
 			    "existence of \"" + identifier + "\" (" +
@@ -685,14 +1768,16 @@ ELFT::Validation::runModifyReferenceDatabase(
 			throw std::runtime_error{"Unknown exception while "
 			    "checking existence of \"" + identifier + '"'};
 		}
-
-		file << "\"" << identifier << "\",\"exists\"," <<
-		    duration(start, stop) << ',' << e2i2s(rs.result) << ',' <<
-		    sanitizeMessage(rs.message ? *rs.message : "") << ',' <<
-		    ts(exists && rs.result == ReturnStatus::Result::Success) <<
-		    '\n';
-		if (!file)
-			throw std::runtime_error{"Error writing to log"};
+		latencies.record(Latencies::Call::Exists, start, stop,
+		    identifier);
+
+		log->quoted(identifier).quoted("exists").
+		    integer(microseconds(start, stop));
+		usage.log(*log, usageBefore, usageAfter);
+		counters.log(*log, before, after);
+		log->integer(rs.result).quoted(rs.message.value_or("")).
+		    integer(exists &&
+		    (rs.result == ReturnStatus::Result::Success));
 		if (exists)
 			break;
 	}
@@ -701,11 +1786,17 @@ ELFT::Validation::runModifyReferenceDatabase(
 	for (auto trials{0}; trials < 5; ++trials) {
 		for (auto i{0}; i < 5; ++i) {
 			ReturnStatus rs{};
+			HardwareCounters::Counts before{}, after{};
+			ResourceUsage::Counts usageBefore{}, usageAfter{};
 			std::chrono::steady_clock::time_point start{}, stop{};
 			try {
+				usageBefore = usage.read();
+				before = counters.read();
 				start = std::chrono::steady_clock::now();
 				rs = impl->remove(identifier);
 				stop = std::chrono::steady_clock::now();
+				after = counters.read();
+				usageAfter = usage.read();
 			} catch (const std::exception &e) {
 				throw std::runtime_error{"Exception while "
 				    "removing \"" + identifier + "\" (" +
@@ -714,23 +1805,26 @@ ELFT::Validation::runModifyReferenceDatabase(
 				throw std::runtime_error{"Unknown exception "
 				    "while removing \"" + identifier + '"'};
 			}
-			file << "\"" << identifier << "\",\"remove\"," <<
-			    duration(start, stop) << ',' << e2i2s(rs.result) <<
-			    ',' <<
-			    sanitizeMessage(rs.message ? *rs.message : "") <<
-			    ',' << (i == 0 ?
+			latencies.record(Latencies::Call::Remove, start, stop,
+			    identifier);
+			log->quoted(identifier).quoted("remove").
+			    integer(microseconds(start, stop));
+			usage.log(*log, usageBefore, usageAfter);
+			counters.log(*log, before, after);
+			log->integer(rs.result).quoted(rs.message.value_or("")).
+			    integer(i == 0 ?
 			    /* It's okay to return Failure if does not exist */
-			    ts(rs.result == ReturnStatus::Result::Success) :
-			    "1") << '\n';
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
+			    rs.result == ReturnStatus::Result::Success : true);
 
 			bool exists{};
 			try {
+				usageBefore = usage.read();
+				before = counters.read();
 				start = std::chrono::steady_clock::now();
 				std::tie(rs, exists) = impl->exists(identifier);
 				stop = std::chrono::steady_clock::now();
+				after = counters.read();
+				usageAfter = usage.read();
 			} catch (const std::exception &e) {
 				throw std::runtime_error{"Exception while "
 				    "checking existence of \"" + identifier +
@@ -740,25 +1834,31 @@ ELFT::Validation::runModifyReferenceDatabase(
 				    "while checking existence of \"" +
 				    identifier + '"'};
 			}
-			file << "\"" << identifier << "\",\"exists\"," <<
-			    duration(start, stop) << ',' << e2i2s(rs.result) <<
-			    ',' <<
-			    sanitizeMessage(rs.message ? *rs.message : "") <<
-			    ',' << ts(!exists &&
-			    rs.result == ReturnStatus::Result::Success) << '\n';
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
+			latencies.record(Latencies::Call::Exists, start, stop,
+			    identifier);
+			log->quoted(identifier).quoted("exists").
+			    integer(microseconds(start, stop));
+			usage.log(*log, usageBefore, usageAfter);
+			counters.log(*log, before, after);
+			log->integer(rs.result).quoted(rs.message.value_or("")).
+			    integer(!exists &&
+			    rs.result == ReturnStatus::Result::Success);
 		}
 
 		/* Insert it */
 		for (auto i{0}; i < 5; ++i) {
 			ReturnStatus rs{};
+			HardwareCounters::Counts before{}, after{};
+			ResourceUsage::Counts usageBefore{}, usageAfter{};
 			std::chrono::steady_clock::time_point start{}, stop{};
 			try {
+				usageBefore = usage.read();
+				before = counters.read();
 				start = std::chrono::steady_clock::now();
 				rs = impl->insert(identifier, refTemplate);
 				stop = std::chrono::steady_clock::now();
+				after = counters.read();
+				usageAfter = usage.read();
 			} catch (const std::exception &e) {
 				throw std::runtime_error{"Exception while "
 				    "inserting \"" + identifier + "\" (" +
@@ -767,21 +1867,24 @@ ELFT::Validation::runModifyReferenceDatabase(
 				throw std::runtime_error{"Unknown exception "
 				    "while inserting \"" + identifier + '"'};
 			}
-			file << "\"" << identifier << "\",\"insert\"," <<
-			    duration(start, stop) << ',' << e2i2s(rs.result) <<
-			    ',' <<
-			    sanitizeMessage(rs.message ? *rs.message : "") <<
-			    ',' << ts(rs.result ==
-			    ReturnStatus::Result::Success) << '\n';
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
+			latencies.record(Latencies::Call::Insert, start, stop,
+			    identifier);
+			log->quoted(identifier).quoted("insert").
+			    integer(microseconds(start, stop));
+			usage.log(*log, usageBefore, usageAfter);
+			counters.log(*log, before, after);
+			log->integer(rs.result).quoted(rs.message.value_or("")).
+			    integer(rs.result == ReturnStatus::Result::Success);
 
 			bool exists{};
 			try {
+				usageBefore = usage.read();
+				before = counters.read();
 				start = std::chrono::steady_clock::now();
 				std::tie(rs, exists) = impl->exists(identifier);
 				stop = std::chrono::steady_clock::now();
+				after = counters.read();
+				usageAfter = usage.read();
 			} catch (const std::exception &e) {
 				throw std::runtime_error{"Exception while "
 				    "checking existence of \"" + identifier +
@@ -791,94 +1894,149 @@ ELFT::Validation::runModifyReferenceDatabase(
 				    "while checking existence of \"" +
 				    identifier + '"'};
 			}
-			file << "\"" << identifier << "\",\"exists\"," <<
-			    duration(start, stop) << ',' << e2i2s(rs.result) <<
-			    ',' <<
-			    sanitizeMessage(rs.message ? *rs.message : "") <<
-			    ',' << ts(exists &&
-			    rs.result == ReturnStatus::Result::Success) << '\n';
-			if (!file)
-				throw std::runtime_error{"Error writing to "
-				    "log"};
+			latencies.record(Latencies::Call::Exists, start, stop,
+			    identifier);
+			log->quoted(identifier).quoted("exists").
+			    integer(microseconds(start, stop));
+			usage.log(*log, usageBefore, usageAfter);
+			counters.log(*log, before, after);
+			log->integer(rs.result).quoted(rs.message.value_or("")).
+			    integer(exists &&
+			    rs.result == ReturnStatus::Result::Success);
 		}
 	}
+
+	log->flush();
+	latencies.writeSummary(args.outputDir /
+	    "modifyReferenceDatabaseLatency.log");
 }
 
 void
 ELFT::Validation::runSearch(
     std::shared_ptr<SearchInterface> impl,
-    const std::vector<uint64_t> &indicies,
-    const Arguments &args)
+    WorkQueue &queue,
+    Latencies &latencies,
+    const Arguments &args,
+    const std::string &workerName)
 {
 	/* Configure candidate list log */
-	const std::string candidateLogName{"searchCandidates-" + ts(getpid()) +
-	    ".log"};
-	std::ofstream candidateLog{args.outputDir / candidateLogName};
-	if (!candidateLog)
-		throw std::runtime_error(ts(getpid()) + ": Error creating "
-		    "candidate log file");
-
-	static const std::string candidateLogHeader{"\"identifier\","
-	    "max_candidates,elapsed,result,\"message\",decision,num_candidates,"
-	    "rank,\"candidate_identifier\",candidate_frgp,"
-	    "candidate_similarity"};
-	candidateLog << candidateLogHeader << '\n';
-	if (!candidateLog)
-		throw std::runtime_error(ts(getpid()) + ": Error writing to "
-		    "candidate log");
+	static const std::vector<Log::Column> candidateColumns{
+	    {"\"identifier\"", Log::Type::QuotedString},
+	    {"max_candidates", Log::Type::Integer},
+	    {"elapsed", Log::Type::Integer},
+	    {"result", Log::Type::Integer},
+	    {"\"message\"", Log::Type::QuotedString},
+	    {"decision", Log::Type::Integer},
+	    {"num_candidates", Log::Type::Integer},
+	    {"rank", Log::Type::Integer},
+	    {"\"candidate_identifier\"", Log::Type::String},
+	    {"candidate_frgp", Log::Type::Integer},
+	    {"candidate_similarity", Log::Type::Real}};
+	const auto candidateLog = openLog(args, "searchCandidates-" +
+	    workerName, candidateColumns);
 
 	/* Configure correspondence log */
-	const std::string corrLogName{"correspondence-" + ts(getpid()) +
-	    ".log"};
-	std::ofstream corrLog{args.outputDir / corrLogName};
-	if (!corrLog)
-		throw std::runtime_error(ts(getpid()) + ": Error creating "
-		    "correspondence log file");
-
-	static const std::string corrLogHeader{"\"identifier\",num_candidates,"
-	    "elapsed,rank,correspondence_index,ref_id,ref_x,ref_y,ref_theta,"
-	    "ref_type,probe_id,probe_x,probe_y,probe_theta,probe_type"};
-	corrLog << corrLogHeader << '\n';
-	if (!corrLog)
-		throw std::runtime_error(ts(getpid()) + ": Error writing to "
-		    "correspondence log");
-
-	for (const auto &n : indicies) {
-		/* Load template */
-		std::string probeIdentifier{};
-		std::tie(probeIdentifier, std::ignore) = Data::Latents.at(n);
-		const auto probeTemplate = readFile(args.outputDir /
-		    Data::LatentTemplateDir /
-		    (probeIdentifier + Data::TemplateSuffix));
-
-		const auto &[searchResult, candidateLogLine] =
-		    performSingleSearch(impl, probeIdentifier, probeTemplate,
-		    static_cast<uint16_t>(args.maximum));
-		candidateLog << candidateLogLine << '\n';
-
-		corrLog << performSingleSearchExtract(impl, probeIdentifier,
-		    probeTemplate, searchResult) << '\n';
-
-		if (!candidateLog)
-			throw std::runtime_error(ts(getpid()) + ": "
-			    "Error writing to candidate log");
+	static const std::vector<Log::Column> corrColumns{
+	    {"\"identifier\"", Log::Type::QuotedString},
+	    {"num_candidates", Log::Type::Integer},
+	    {"elapsed", Log::Type::Integer},
+	    {"rank", Log::Type::Integer},
+	    {"correspondence_index", Log::Type::Integer},
+	    {"ref_id", Log::Type::Integer},
+	    {"ref_x", Log::Type::Integer},
+	    {"ref_y", Log::Type::Integer},
+	    {"ref_theta", Log::Type::Integer},
+	    {"ref_type", Log::Type::Integer},
+	    {"probe_id", Log::Type::Integer},
+	    {"probe_x", Log::Type::Integer},
+	    {"probe_y", Log::Type::Integer},
+	    {"probe_theta", Log::Type::Integer},
+	    {"probe_type", Log::Type::Integer}};
+	const auto corrLog = openLog(args, "correspondence-" + workerName,
+	    corrColumns);
+	/* The main thread, and any --threads workers */
+	const HardwareCounters counters{args.hardwareCounters,
+	    (args.numThreads > 1) ? (args.numThreads + 1u) : 1u};
+	const ResourceUsage usage{args.resourceUsage, args.numThreads > 1};
+
+	for (auto batch = queue.next(); !batch.empty(); batch = queue.next()) {
+		for (const auto &n : batch) {
+			/* Load template */
+			const auto probeIdentifier = getManifest(args).
+			    getIdentifier(TemplateType::Probe, n);
+			const auto probeTemplate = readFile(args.outputDir /
+			    Data::LatentTemplateDir /
+			    (probeIdentifier + Data::TemplateSuffix));
+
+			const auto searchResult = performSingleSearch(impl,
+			    probeIdentifier, probeTemplate,
+			    static_cast<uint16_t>(args.maximum), *candidateLog,
+			    latencies, counters, usage);
+			performSingleSearchExtract(impl, probeIdentifier,
+			    probeTemplate, searchResult, *corrLog, latencies,
+			    counters, usage);
+		}
 	}
+
+	candidateLog->flush();
+	corrLog->flush();
 }
 
-std::string
+void
+ELFT::Validation::runWorker(
+    const std::variant<std::shared_ptr<ExtractionInterface>,
+    std::shared_ptr<SearchInterface>> &impl,
+    WorkQueue &queue,
+    Latencies &latencies,
+    const Arguments &args,
+    const std::string &workerName)
+{
+	switch (args.operation.value()) {
+	case Operation::Extract: {
+		/* Only extract data from templates this worker created */
+		const auto created = runExtractionCreate(std::get<
+		    std::shared_ptr<ELFT::ExtractionInterface>>(impl), queue,
+		    latencies, args, workerName);
+		runExtractionExtractData(std::get<std::shared_ptr<
+		    ELFT::ExtractionInterface>>(impl), created, latencies,
+		    args, workerName);
+		break;
+	}
+	case Operation::Search:
+		runSearch(std::get<std::shared_ptr<
+		    ELFT::SearchInterface>>(impl), queue, latencies, args,
+		    workerName);
+		break;
+	default:
+		throw std::runtime_error("Unsupported operation was sent to "
+		    "runWorker()");
+	}
+}
+
+void
 ELFT::Validation::performSingleExtractData(
     const std::shared_ptr<ExtractionInterface> impl,
     TemplateType templateType,
-    const std::filesystem::path &p)
+    const std::filesystem::path &p,
+    Log &log,
+    Latencies &latencies,
+    const HardwareCounters &counters,
+    const ResourceUsage &usage)
 {
 	const CreateTemplateResult ctr{{}, readFile(p)};
 	std::optional<std::vector<TemplateData>> data{};
 
+	HardwareCounters::Counts before{}, after{};
+	ResourceUsage::Counts usageBefore{}, usageAfter{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
+		usageBefore = usage.read();
+		before = counters.read();
 		start = std::chrono::steady_clock::now();
 		data = impl->extractTemplateData(templateType, ctr);
 		stop = std::chrono::steady_clock::now();
+		after = counters.read();
+		usageAfter = usage.read();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while extracting data from "
 		    "template " + p.string() + " (" + e.what() + ")");
@@ -887,98 +2045,72 @@ ELFT::Validation::performSingleExtractData(
 		    "data from template " + p.string());
 	}
 
-	const std::string logLinePrefix{'"' + p.filename().string() + "\"," +
-	    duration(start, stop) + ',' + e2i2s(templateType) + ','};
+	const std::string filename{p.filename().string()};
+	const auto elapsed = microseconds(start, stop);
+	latencies.record(Latencies::Call::ExtractTemplateData, start, stop,
+	    filename);
 
 	if (!data) {
 		static const uint8_t numElements{18};
-		static const std::string NAFull = splice(
-		    std::vector<std::string>(numElements, NA), ",");
-		return (logLinePrefix + NAFull);
+		log.quoted(filename).integer(elapsed);
+		usage.log(log, usageBefore, usageAfter);
+		counters.log(log, before, after);
+		log.integer(templateType).na(numElements);
+		return;
 	}
 
-	std::string logLine{};
 	for (decltype(data)::value_type::size_type i{}; i < data->size(); ++i) {
 		const auto &td = data->at(i);
 
-		logLine += logLinePrefix + ts(i) + ',' + ts(data->size()) +
-		    ',' + ts(td.inputIdentifier) + ',';
-		logLine += (td.imageQuality ? ts(*td.imageQuality) : NA) + ',';
+		log.quoted(filename).integer(elapsed);
+		usage.log(log, usageBefore, usageAfter);
+		counters.log(log, before, after);
+		log.integer(templateType).integer(i).integer(data->size()).
+		    integer(td.inputIdentifier).integer(td.imageQuality);
 
 		static const uint8_t efsElements{14};
-		static const std::string NAEFS = splice(
-		    std::vector<std::string>(efsElements, NA), ",");
 		if (!td.efs) {
-			logLine += NAEFS + '\n';
+			log.na(efsElements);
 			continue;
 		}
 
 		const auto &efs = td.efs.value();
-		logLine += e2i2s(efs.imp) + ',' + e2i2s(efs.frct) + ',' +
-		    e2i2s(efs.frgp) + ',';
-		logLine += (efs.orientation ? ts(*efs.orientation) : NA) +
-		    ',';
-		logLine += (efs.lpm ? splice(*efs.lpm) : NA) + ',';
-		logLine += (efs.valueAssessment ?
-		    e2i2s(*efs.valueAssessment) : NA) + ',';
-		logLine += (efs.lsb ? e2i2s(*efs.lsb) : NA) + ',';
-		logLine += (efs.pat ? e2i2s(*efs.pat) : NA) + ',';
-		logLine += (efs.plr ? ts(*efs.plr) : NA) + ',';
-		logLine += (efs.trv ? ts(*efs.trv) : NA) + ',';
-		logLine += (efs.cores ? splice(*efs.cores) : NA) + ',';
-		logLine += (efs.deltas ? splice(*efs.deltas) : NA) + ',';
-		logLine += (efs.minutia ? splice(*efs.minutia) : NA) + ',';
-		logLine += (efs.roi ? splice(*efs.roi) : NA);
-
-		logLine += '\n';
-	}
-
-	/* Remove last newline */
-	logLine.pop_back();
-	return (logLine);
+		log.integer(efs.imp).integer(efs.frct).integer(efs.frgp).
+		    integer(efs.orientation).tuples(efs.lpm).
+		    integer(efs.valueAssessment).integer(efs.lsb).
+		    integer(efs.pat).integer(efs.plr).integer(efs.trv).
+		    tuples(efs.cores).tuples(efs.deltas).tuples(efs.minutia).
+		    tuples(efs.roi);
+	}
 }
 
-std::string
+void
 ELFT::Validation::performSingleCreate(
     const std::shared_ptr<ExtractionInterface> impl,
     const uint64_t imageIndex,
-    const Arguments &args)
+    const Samples &samples,
+    const Arguments &args,
+    Log &log,
+    Latencies &latencies,
+    const HardwareCounters &counters,
+    const ResourceUsage &usage)
 {
-	const auto &[identifier, mds] = getImageSet(imageIndex,
-	    *args.templateType);
-	std::vector<std::tuple<std::optional<Image>, std::optional<EFS>>>
-	    samples{};
-	for (decltype(mds)::size_type i{}; i < mds.size(); ++i) {
-		const auto &md = mds.at(i);
-
-		if (!md.filename && !md.efs)
-			throw std::runtime_error("No filename or EFS data "
-			    "provided for imageIndex = " + ts(imageIndex));
-
-		if (md.filename) {
-			if (!md.width || !md.height || !md.ppi || !md.bpc ||
-			    !md.bpp)
-				throw std::runtime_error("Missing image meta"
-				    "data for imageIndex = " + ts(imageIndex));
-
-			if (md.efs && (md.efs->identifier != i))
-				throw std::runtime_error("ID != for Image and "
-				    "EFS for imageIndex = " + ts(imageIndex));
-
-			samples.emplace_back(Image(static_cast<uint8_t>(i),
-			    *md.width, *md.height, *md.ppi, *md.bpc, *md.bpp,
-			    readFile(args.imageDir / *md.filename)), md.efs);
-		} else
-			samples.emplace_back(std::nullopt, md.efs);
-	}
+	const auto identifier = getManifest(args).getIdentifier(
+	    *args.templateType, imageIndex);
 
 	CreateTemplateResult rv{};
+	HardwareCounters::Counts before{}, after{};
+	ResourceUsage::Counts usageBefore{}, usageAfter{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
+		usageBefore = usage.read();
+		before = counters.read();
 		start = std::chrono::steady_clock::now();
 		rv = impl->createTemplate(*args.templateType, identifier,
 		    samples);
 		stop = std::chrono::steady_clock::now();
+		after = counters.read();
+		usageAfter = usage.read();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while creating template "
 		    "from " + identifier + " (" + e.what() + ")");
@@ -986,32 +2118,39 @@ ELFT::Validation::performSingleCreate(
 		throw std::runtime_error("Unknown exception while creating "
 		    "template from " + identifier);
 	}
-
-	std::string logLine{'"' + identifier + "\"," + duration(start, stop) +
-	    ',' + e2i2s(rv.status.result) + ',' + sanitizeMessage(
-	    rv.status.message ? *rv.status.message : "") + ',' +
-	    e2i2s(*args.templateType) + ',' + ts(samples.size()) + ','};
+	latencies.record(Latencies::Call::CreateTemplate, start, stop,
+	    identifier);
 
 	/* Write template */
 	const auto dir = args.outputDir /
 	    Data::getTemplateDir(*args.templateType);
-	if (rv.status.result == ReturnStatus::Result::Success) {
+	const bool success{rv.status.result == ReturnStatus::Result::Success};
+	if (success)
 		writeFile(rv.data, dir / (identifier + Data::TemplateSuffix));
-		logLine += ts(rv.data.size());
-	} else {
+	else
 		writeFile({}, dir / (identifier + Data::TemplateSuffix));
-		logLine += NA;
-	}
 
-	return (logLine);
+	log.quoted(identifier).integer(microseconds(start, stop));
+	usage.log(log, usageBefore, usageAfter);
+	counters.log(log, before, after);
+	log.integer(rv.status.result).quoted(rv.status.message.value_or("")).
+	    integer(*args.templateType).integer(samples.size());
+	if (success)
+		log.integer(rv.data.size());
+	else
+		log.na();
 }
 
-std::tuple<ELFT::SearchResult, std::string>
+ELFT::SearchResult
 ELFT::Validation::performSingleSearch(
     const std::shared_ptr<SearchInterface> impl,
     const std::string &identifier,
     const std::vector<std::byte> &probeTemplate,
-    const uint16_t maxCandidates)
+    const uint16_t maxCandidates,
+    Log &log,
+    Latencies &latencies,
+    const HardwareCounters &counters,
+    const ResourceUsage &usage)
 {
 	/*
 	 * NOTE: We don't search 0-byte templates, even if that's what was
@@ -1027,11 +2166,17 @@ ELFT::Validation::performSingleSearch(
 // 	}
 
 	SearchResult rv{};
+	HardwareCounters::Counts before{}, after{};
+	ResourceUsage::Counts usageBefore{}, usageAfter{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
+		usageBefore = usage.read();
+		before = counters.read();
 		start = std::chrono::steady_clock::now();
 		rv = impl->search(probeTemplate, maxCandidates);
 		stop = std::chrono::steady_clock::now();
+		after = counters.read();
+		usageAfter = usage.read();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while searching template "
 		    "for " + identifier + " (" + e.what() + ")");
@@ -1039,12 +2184,10 @@ ELFT::Validation::performSingleSearch(
 		throw std::runtime_error("Unknown exception while searching "
 		    "template for " + identifier);
 	}
+	latencies.record(Latencies::Call::Search, start, stop, identifier);
 
-	const std::string logLinePrefix{'"' + identifier + "\"," +
-	    ts(maxCandidates) + ',' + duration(start, stop) + ',' +
-	    e2i2s(rv.status.result) + ',' +
-	    sanitizeMessage(rv.status.message ? *rv.status.message : "") + ','};
-	std::string logLine{};
+	const auto elapsed = microseconds(start, stop);
+	const std::string message{rv.status.message.value_or("")};
 	if (rv.status && (rv.candidateList.size() > 0)) {
 		/* API says driver will stable sort by similarity */
 		std::stable_sort(rv.candidateList.begin(),
@@ -1052,27 +2195,37 @@ ELFT::Validation::performSingleSearch(
 
 		std::vector<Candidate>::size_type rank{};
 		for (const auto &c : rv.candidateList) {
-			logLine += logLinePrefix + ts(rv.decision) + ',' +
-			    ts(rv.candidateList.size()) + ',' + ts(++rank) +
-			    ',' + c.identifier + ',' + e2i2s(c.frgp) + ',' +
-			    ts(c.similarity);
-			if (rank < rv.candidateList.size())
-				logLine += '\n';
+			log.quoted(identifier).integer(maxCandidates).
+			    integer(elapsed);
+			usage.log(log, usageBefore, usageAfter);
+			counters.log(log, before, after);
+			log.integer(rv.status.result).
+			    quoted(message).integer(rv.decision).
+			    integer(rv.candidateList.size()).integer(++rank).
+			    string(c.identifier).integer(c.frgp).
+			    real(c.similarity);
 		}
 	} else {
-		logLine += logLinePrefix + splice(
-		    std::vector<std::string>(5, NA), ",");
+		static const uint8_t numElements{6};
+		log.quoted(identifier).integer(maxCandidates).integer(elapsed);
+		usage.log(log, usageBefore, usageAfter);
+		counters.log(log, before, after);
+		log.integer(rv.status.result).quoted(message).na(numElements);
 	}
 
-	return {rv, logLine};
+	return (rv);
 }
 
-std::string
+void
 ELFT::Validation::performSingleSearchExtract(
     const std::shared_ptr<SearchInterface> impl,
     const std::string &identifier,
     const std::vector<std::byte> &probeTemplate,
-    const SearchResult &searchResult)
+    const SearchResult &searchResult,
+    Log &log,
+    Latencies &latencies,
+    const HardwareCounters &counters,
+    const ResourceUsage &usage)
 {
 	/*
 	 * NOTE: We don't search 0-byte templates, even if that's what was
@@ -1088,12 +2241,18 @@ ELFT::Validation::performSingleSearchExtract(
 // 	}
 
 	std::optional<std::vector<std::vector<Correspondence>>> corrs{};
+	HardwareCounters::Counts before{}, after{};
+	ResourceUsage::Counts usageBefore{}, usageAfter{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
+		usageBefore = usage.read();
+		before = counters.read();
 		start = std::chrono::steady_clock::now();
 		corrs = impl->extractCorrespondence(probeTemplate,
 		    searchResult);
 		stop = std::chrono::steady_clock::now();
+		after = counters.read();
+		usageAfter = usage.read();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while extracting "
 		    "correspondence for " + identifier + " (" + e.what() + ")");
@@ -1101,16 +2260,19 @@ ELFT::Validation::performSingleSearchExtract(
 		throw std::runtime_error("Unknown exception while extracting "
 		    "correspondence for " + identifier);
 	}
+	latencies.record(Latencies::Call::ExtractCorrespondence, start, stop,
+	    identifier);
 
-	const std::string logLinePrefix{'"' + identifier + "\"," +
-	    ts(searchResult.candidateList.size()) + ',' +
-	    duration(start, stop) + ','};
+	const auto numCandidates = searchResult.candidateList.size();
+	const auto elapsed = microseconds(start, stop);
 
 	if (!corrs.has_value()) {
 		static const uint8_t numElements{12};
-		static const std::string NAFull = splice(
-		    std::vector<std::string>(numElements, NA), ",");
-		return (logLinePrefix + NAFull);
+		log.quoted(identifier).integer(numCandidates).integer(elapsed);
+		usage.log(log, usageBefore, usageAfter);
+		counters.log(log, before, after);
+		log.na(numElements);
+		return;
 	}
 
 	if (searchResult.candidateList.size() != corrs->size())
@@ -1118,31 +2280,62 @@ ELFT::Validation::performSingleSearchExtract(
 		    "of Correspondences must be the same as the number of "
 		    "Candidates."};
 
-	std::string logLine{};
 	std::vector<std::vector<Correspondence>>::size_type rank{};
 	for (const auto &candidate : *corrs) {
 		++rank;
 		std::vector<Correspondence>::size_type corrIndex{};
 		for (const auto &corr : candidate) {
-			logLine += logLinePrefix +
-			    ts(rank) + ',' + ts(++corrIndex) + ',' +
-			    ts(corr.referenceInputIdentifier) + ',' +
-			    ts(corr.referenceMinutia.coordinate.x) + ',' +
-			    ts(corr.referenceMinutia.coordinate.y) + ',' +
-			    ts(corr.referenceMinutia.theta) + ',' +
-			    e2i2s(corr.referenceMinutia.type) + ',' +
-			    ts(corr.probeInputIdentifier) + ',' +
-			    ts(corr.probeMinutia.coordinate.x) + ',' +
-			    ts(corr.probeMinutia.coordinate.y) + ',' +
-			    ts(corr.probeMinutia.theta) + ',' +
-			    e2i2s(corr.probeMinutia.type) + '\n';
+			log.quoted(identifier).integer(numCandidates).
+			    integer(elapsed);
+			usage.log(log, usageBefore, usageAfter);
+			counters.log(log, before, after);
+			log.integer(rank).integer(++corrIndex).
+			    integer(corr.referenceInputIdentifier).
+			    integer(corr.referenceMinutia.coordinate.x).
+			    integer(corr.referenceMinutia.coordinate.y).
+			    integer(corr.referenceMinutia.theta).
+			    integer(corr.referenceMinutia.type).
+			    integer(corr.probeInputIdentifier).
+			    integer(corr.probeMinutia.coordinate.x).
+			    integer(corr.probeMinutia.coordinate.y).
+			    integer(corr.probeMinutia.theta).
+			    integer(corr.probeMinutia.type);
 		}
 	}
+}
 
-	/* Remove last newline */
-	logLine.pop_back();
+std::vector<std::string>
+ELFT::Validation::splitCSVLine(
+    const std::string &line)
+{
+	std::vector<std::string> values{};
+	std::string value{};
+	bool quoted{false};
+	for (std::string::size_type i{0}; i < line.size(); ++i) {
+		const char c{line[i]};
+		if (quoted) {
+			/* sanitizeMessage() escapes " as \" */
+			if ((c == '\\') && ((i + 1) < line.size()) &&
+			    (line[i + 1] == '"')) {
+				value += '"';
+				++i;
+			} else if (c == '"') {
+				quoted = false;
+			} else {
+				value += c;
+			}
+		} else if (c == '"') {
+			quoted = true;
+		} else if (c == ',') {
+			values.push_back(std::move(value));
+			value.clear();
+		} else {
+			value += c;
+		}
+	}
+	values.push_back(std::move(value));
 
-	return (logLine);
+	return (values);
 }
 
 std::string
@@ -1179,36 +2372,6 @@ ELFT::Validation::sanitizeMessage(
 	return (wrapInQuotes ? '"' + sanitized + '"' : sanitized);
 }
 
-std::vector<std::vector<uint64_t>>
-ELFT::Validation::splitSet(
-    const std::vector<uint64_t> &combinedSet,
-    const uint8_t numSets)
-{
-	if (numSets == 0)
-		return {};
-	if (numSets == 1)
-		return {combinedSet};
-
-	const std::vector<uint64_t>::size_type size{static_cast<
-	    std::vector<uint64_t>::size_type>(
-	    std::ceil(static_cast<float>(combinedSet.size()) /
-	    static_cast<float>(numSets)))};
-	if (size < numSets)
-		throw std::invalid_argument("Too many sets.");
-
-	std::vector<std::vector<uint64_t>> sets{};
-	sets.reserve(numSets);
-	for (uint8_t i{0}; i < numSets; ++i)
-		sets.emplace_back(std::next(combinedSet.begin(),
-		    static_cast<std::vector<uint64_t>::difference_type>(
-		    size * i)),
-		    std::next(combinedSet.begin(),
-		    static_cast<std::vector<uint64_t>::difference_type>(
-		    std::min(size * (i + 1u), combinedSet.size()))));
-
-	return (sets);
-}
-
 void
 ELFT::Validation::testOperation(
     const Arguments &args)
@@ -1227,17 +2390,10 @@ ELFT::Validation::testOperation(
 	uint64_t containerSize{};
 	switch (args.operation.value()) {
 	case Operation::Extract:
-		switch (args.templateType.value()) {
-		case TemplateType::Probe:
-			containerSize = Data::Latents.size();
-			break;
-		case TemplateType::Reference:
-			containerSize = Data::References.size();
-			break;
-		}
+		containerSize = getManifest(args).size(*args.templateType);
 		break;
 	case Operation::Search:
-		containerSize = Data::Latents.size();
+		containerSize = getManifest(args).size(TemplateType::Probe);
 		break;
 	default:
 		throw std::runtime_error("Unsupported operation was send to "
@@ -1246,16 +2402,15 @@ ELFT::Validation::testOperation(
 	const auto indicies = randomizeIndicies(containerSize, args.randomSeed);
 
 	/* Instantiate only the appropriate interface */
+	Latencies latencies{};
 	std::variant<std::shared_ptr<ELFT::ExtractionInterface>,
 	    std::shared_ptr<ELFT::SearchInterface>> impl{};
 	switch (args.operation.value()) {
 	case Operation::Extract:
-		impl = ELFT::ExtractionInterface::getImplementation(
-		    args.configDir);
+		impl = getExtractionImplementation(args, latencies);
 		break;
 	case Operation::Search:
-		impl = ELFT::SearchInterface::getImplementation(
-		    args.configDir, args.dbDir);
+		impl = getSearchImplementation(args, latencies);
 		break;
 	default:
 		throw std::runtime_error("Unsupported operation was sent to "
@@ -1263,55 +2418,53 @@ ELFT::Validation::testOperation(
 		break;
 	}
 
-	if (args.numProcs <= 1) {
-		switch (args.operation.value()) {
-		case Operation::Extract:
-			runExtractionCreate(std::get<std::shared_ptr<
-			    ELFT::ExtractionInterface>>(impl), indicies, args);
- 			runExtractionExtractData(std::get<std::shared_ptr<
- 			    ELFT::ExtractionInterface>>(impl), indicies, args);
-			break;
-		case Operation::Search:
- 			runSearch(std::get<std::shared_ptr<
- 			    ELFT::SearchInterface>>(impl), indicies, args);
-			break;
-		default:
-			throw std::runtime_error("Unsupported operation was "
-			    "sent to testOperation()");
-			break;
+	/* Workers claim indicies as they go, instead of fixed slices */
+	WorkQueue queue{indicies, std::max(args.numProcs, args.numThreads)};
+	if (args.hardwareCounters) {
+		/* Warn of missing events here, instead of in every worker */
+		const HardwareCounters warning{true, 1};
+	}
+
+	std::vector<std::string> workerNames{};
+	if (args.numThreads > 1) {
+		/*
+		 * All threads share the single instance of the interface, as
+		 * an implementation would be hosted in a multithreaded service.
+		 */
+		std::vector<std::exception_ptr> errors(args.numThreads);
+		std::vector<std::thread> threads{};
+		threads.reserve(args.numThreads);
+		for (uint8_t i{0}; i < args.numThreads; ++i)
+			workerNames.push_back(getWorkerName(getpid(), i));
+		for (uint8_t i{0}; i < args.numThreads; ++i) {
+			threads.emplace_back([&, i]() {
+				try {
+					runWorker(impl, queue, latencies,
+					    args, workerNames[i]);
+				} catch (...) {
+					errors[i] = std::current_exception();
+				}
+			});
 		}
+		for (auto &thread : threads)
+			thread.join();
+
+		for (const auto &error : errors)
+			if (error)
+				std::rethrow_exception(error);
+	} else if (args.numProcs <= 1) {
+		workerNames.push_back(getWorkerName(getpid()));
+		runWorker(impl, queue, latencies, args,
+		    workerNames.front());
 	} else {
-		/* Split into multiple sets of indicies */
-		const auto sets = splitSet(indicies, args.numProcs);
-
 		/* Fork */
-		for (const auto &set : sets) {
+		for (uint8_t i{0}; i < args.numProcs; ++i) {
 			const auto pid = fork();
 			switch (pid) {
 			case 0:		/* Child */
 				try {
-					switch (args.operation.value()) {
-					case Operation::Extract:
-						runExtractionCreate(std::get<
-						    std::shared_ptr<
-						    ELFT::ExtractionInterface>>(
-						    impl), set, args);
-		 				runExtractionExtractData(std::
-		 				    get<std::shared_ptr<
-		 				    ELFT::ExtractionInterface>>(
-		 				    impl), set, args);
-						break;
-					case Operation::Search:
- 						runSearch(std::get<
- 						    std::shared_ptr<
- 						    ELFT::SearchInterface>>(
- 						    impl), indicies, args);
-						break;
-					default:
-						throw std::runtime_error(
-						    "Invalid operation sent to "
-						    "testOperation()");
-					}
+					runWorker(impl, queue, latencies,
+					    args, getWorkerName(getpid()));
 				} catch (const std::exception &e) {
 					std::cerr << e.what() << '\n';
 					std::exit(EXIT_FAILURE);
@@ -1327,12 +2480,37 @@ ELFT::Validation::testOperation(
 			case -1:	/* Error */
 				throw std::runtime_error("Error during fork()");
 			default:	/* Parent */
+				workerNames.push_back(getWorkerName(pid));
 				break;
 			}
 		}
 
 		waitForExit(args.numProcs);
 	}
+
+	/*
+	 * Each probe was searched by exactly one worker. Combine the workers'
+	 * logs into one, in Manifest order. ColumnarLogs are left for
+	 * conversion offline.
+	 */
+	if ((args.operation == Operation::Search) && !args.columnarLogs) {
+		std::vector<std::string> identifiers{};
+		const auto &manifest = getManifest(args);
+		identifiers.reserve(manifest.size(TemplateType::Probe));
+		for (uint64_t i{}; i < manifest.size(TemplateType::Probe); ++i)
+			identifiers.push_back('"' + manifest.getIdentifier(
+			    TemplateType::Probe, i) + '"');
+
+		mergeLogs(args, "searchCandidates", workerNames, identifiers);
+		mergeLogs(args, "correspondence", workerNames, identifiers);
+	}
+
+	/* Workers recorded into shared memory, so this covers all of them */
+	if (args.operation == Operation::Extract)
+		latencies.writeSummary(args.outputDir / ("extractionLatency-" +
+		    e2i2s(*args.templateType) + ".log"));
+	else
+		latencies.writeSummary(args.outputDir / "searchLatency.log");
 }
 
 void
@@ -1388,41 +2566,1844 @@ ELFT::Validation::writeFile(
 		    ts(data.size()) + " bytes to " + pathName);
 }
 
-int
-main(
-    int argc,
-    char *argv[])
+ELFT::Validation::MappedFile::MappedFile(
+    const std::string &pathName)
 {
-	if (!((ELFT::API_MAJOR_VERSION == 0) &&
-	    (ELFT::API_MINOR_VERSION == 0) &&
-	    (ELFT::API_PATCH_VERSION == 1))) {
-		std::cerr << "Incompatible API version encountered.\n "
-		    "- Validation: 0.0.1\n - Participant: " <<
-		    ELFT::API_MAJOR_VERSION << '.' <<
-		    ELFT::API_MINOR_VERSION << '.' <<
-		    ELFT::API_PATCH_VERSION << '\n';
-		std::cerr << "Rebuild your core library with the latest "
-		    "elft.h\n";
-		return (EXIT_FAILURE);
+	const int fd = ::open(pathName.c_str(), O_RDONLY);
+	if (fd == -1)
+		throw std::runtime_error{"Could not open " + pathName};
+
+	struct stat sb{};
+	if (::fstat(fd, &sb) != 0) {
+		::close(fd);
+		throw std::runtime_error{"Could not open " + pathName};
+	}
+	this->length = static_cast<std::size_t>(sb.st_size);
+
+	/* Can't map an empty file (e.g., template from failed creation) */
+	if (this->length != 0) {
+		this->address = ::mmap(nullptr, this->length, PROT_READ,
+		    MAP_PRIVATE, fd, 0);
+		if (this->address == MAP_FAILED) {
+			const std::string error{std::system_error(errno,
+			    std::system_category()).code().message()};
+			::close(fd);
+			throw std::runtime_error{"Could not map " + pathName +
+			    " (" + error + ')'};
+		}
+		/* Read once, front to back */
+		::madvise(this->address, this->length, MADV_SEQUENTIAL);
 	}
+	::close(fd);
+}
 
-	ELFT::Validation::Arguments args{};
-	try {
-		args = ELFT::Validation::parseArguments(argc, argv);
-	} catch (const std::exception &e) {
-		std::cerr << "[ERROR] " << e.what() << '\n';
-		std::cerr << ELFT::Validation::getUsageString(argv[0]) <<
-		    '\n';
-		return (EXIT_FAILURE);
+ELFT::Validation::MappedFile::~MappedFile()
+{
+	if (this->address != nullptr)
+		::munmap(this->address, this->length);
+}
+
+const std::byte*
+ELFT::Validation::MappedFile::data()
+    const
+    noexcept
+{
+	return (static_cast<const std::byte*>(this->address));
+}
+
+std::size_t
+ELFT::Validation::MappedFile::size()
+    const
+    noexcept
+{
+	return (this->length);
+}
+
+ELFT::Validation::Manifest::Manifest(
+    const std::filesystem::path &path) :
+    path{path},
+    file{path.string()}
+{
+	const std::string_view contents{
+	    reinterpret_cast<const char*>(this->file.data()),
+	    this->file.size()};
+
+	/* Only find where each line starts; entries are parsed on demand */
+	uint64_t lineNumber{};
+	std::string_view::size_type offset{};
+	while (offset < contents.size()) {
+		auto end = contents.find('\n', offset);
+		if (end == std::string_view::npos)
+			end = contents.size();
+		++lineNumber;
+
+		const auto line = contents.substr(offset, end - offset);
+		if (!line.empty() && (line.front() != '#')) {
+			const auto set = line.substr(0, line.find('\t'));
+			if (set == "latent")
+				this->latents.push_back(offset);
+			else if (set == "reference")
+				this->references.push_back(offset);
+			else
+				throw std::runtime_error{path.string() + ':' +
+				    ts(lineNumber) + ": unknown image set \"" +
+				    std::string(set) + '"'};
+		}
+
+		offset = end + 1;
 	}
+}
 
-	try {
-		return (ELFT::Validation::dispatchOperation(args));
-	} catch (const std::exception &e) {
-		std::cerr << "[ERROR] " << e.what() << '\n';
-		return (EXIT_FAILURE);
-	} catch (...) {
-		std::cerr << "[ERROR] Caught non-standard exception." << '\n';
-		return (EXIT_FAILURE);
+std::string
+ELFT::Validation::Manifest::getIdentifier(
+    const TemplateType templateType,
+    const uint64_t index)
+    const
+{
+	const auto line = this->getLine(templateType, index);
+	const auto tab = line.find('\t');
+	if (tab == std::string_view::npos)
+		throw std::runtime_error{"No identifier for image set " +
+		    ts(index) + " in " + this->path.string()};
+
+	const auto identifier = line.substr(tab + 1);
+	return (std::string(identifier.substr(0, identifier.find('\t'))));
+}
+
+ELFT::Validation::Data::ImageSet
+ELFT::Validation::Manifest::getImageSet(
+    const TemplateType templateType,
+    const uint64_t index)
+    const
+{
+	const auto fields = split(this->getLine(templateType, index), '\t');
+	if ((fields.size() < 2) || fields[1].empty())
+		throw std::runtime_error{"No identifier for image set " +
+		    ts(index) + " in " + this->path.string()};
+
+	Data::ImageSet imageSet{std::string(fields[1]), {}};
+	imageSet.second.reserve(fields.size() - 2);
+	for (auto it = std::next(fields.cbegin(), 2); it != fields.cend(); ++it)
+		imageSet.second.push_back(parseImage(*it, imageSet.first));
+
+	return (imageSet);
+}
+
+std::string_view
+ELFT::Validation::Manifest::getLine(
+    const TemplateType templateType,
+    const uint64_t index)
+    const
+{
+	std::string_view::size_type offset{};
+	switch (templateType) {
+	case TemplateType::Probe:
+		offset = this->latents.at(index);
+		break;
+	case TemplateType::Reference:
+		offset = this->references.at(index);
+		break;
+	default:
+		throw std::runtime_error{"Unknown TemplateType sent to "
+		    "Manifest::getLine()"};
+	}
+
+	const std::string_view contents{
+	    reinterpret_cast<const char*>(this->file.data()),
+	    this->file.size()};
+	const auto end = contents.find('\n', offset);
+	if (end == std::string_view::npos)
+		return (contents.substr(offset));
+	return (contents.substr(offset, end - offset));
+}
+
+ELFT::Validation::Data::ImageMetadata
+ELFT::Validation::Manifest::parseImage(
+    const std::string_view image,
+    const std::string &identifier)
+{
+	const auto coordinates = [](const std::string_view list) {
+		std::vector<Coordinate> v{};
+		for (const auto &coordinate : split(list, '-')) {
+			const auto xy = split(coordinate, ';');
+			if (xy.size() != 2)
+				throw std::invalid_argument{"expected x;y"};
+			v.emplace_back(parseInteger<uint32_t>(xy[0]),
+			    parseInteger<uint32_t>(xy[1]));
+		}
+		return (v);
+	};
+	const auto boolean = [](const std::string_view value) {
+		const auto b = parseInteger<uint8_t>(value);
+		if (b > 1)
+			throw std::invalid_argument{"expected 0 or 1"};
+		return (b == 1);
+	};
+
+	Data::ImageMetadata md{};
+	EFS efs{};
+	bool hasEFS{false}, hasEFSFields{false};
+	for (const auto &pair : split(image, ' ')) {
+		const auto equals = pair.find('=');
+		const auto key = pair.substr(0, equals);
+		const auto value = (equals == std::string_view::npos ?
+		    std::string_view{} : pair.substr(equals + 1));
+
+		try {
+			if (equals == std::string_view::npos)
+				throw std::invalid_argument{"no value"};
+
+			if (key == "file") {
+				md.filename = std::string(value);
+			} else if (key == "width") {
+				md.width = parseInteger<uint16_t>(value);
+			} else if (key == "height") {
+				md.height = parseInteger<uint16_t>(value);
+			} else if (key == "ppi") {
+				md.ppi = parseInteger<uint16_t>(value);
+			} else if (key == "bpc") {
+				md.bpc = parseInteger<uint8_t>(value);
+			} else if (key == "bpp") {
+				md.bpp = parseInteger<uint8_t>(value);
+			} else if (key == "efs") {
+				efs.identifier = parseInteger<uint8_t>(value);
+				hasEFS = true;
+			} else {
+				hasEFSFields = true;
+				if (key == "imp") {
+					efs.imp = static_cast<Impression>(
+					    parseInteger<int>(value));
+				} else if (key == "frct") {
+					efs.frct = static_cast<
+					    FrictionRidgeCaptureTechnology>(
+					    parseInteger<int>(value));
+				} else if (key == "frgp") {
+					efs.frgp = static_cast<
+					    FrictionRidgeGeneralizedPosition>(
+					    parseInteger<int>(value));
+				} else if (key == "orientation") {
+					efs.orientation =
+					    parseInteger<int16_t>(value);
+				} else if (key == "lpm") {
+					efs.lpm.emplace();
+					for (const auto &m : split(value, '-'))
+						efs.lpm->push_back(static_cast<
+						    ProcessingMethod>(
+						    parseInteger<int>(m)));
+				} else if (key == "value") {
+					efs.valueAssessment = static_cast<
+					    ValueAssessment>(
+					    parseInteger<int>(value));
+				} else if (key == "lsb") {
+					efs.lsb = static_cast<Substrate>(
+					    parseInteger<int>(value));
+				} else if (key == "pat") {
+					efs.pat = static_cast<
+					    PatternClassification>(
+					    parseInteger<int>(value));
+				} else if (key == "plr") {
+					efs.plr = boolean(value);
+				} else if (key == "trv") {
+					efs.trv = boolean(value);
+				} else if (key == "cores") {
+					efs.cores = coordinates(value);
+				} else if (key == "deltas") {
+					efs.deltas = coordinates(value);
+				} else if (key == "minutia") {
+					efs.minutia.emplace();
+					for (const auto &m : split(value,
+					    '-')) {
+						const auto v = split(m, ';');
+						if (v.size() != 4)
+							throw std::
+							    invalid_argument{
+							    "expected x;y;"
+							    "theta;type"};
+						efs.minutia->emplace_back(
+						    Coordinate(
+						    parseInteger<uint32_t>(
+						    v[0]),
+						    parseInteger<uint32_t>(
+						    v[1])),
+						    parseInteger<uint16_t>(
+						    v[2]),
+						    static_cast<MinutiaType>(
+						    parseInteger<int>(v[3])));
+					}
+				} else if (key == "roi") {
+					efs.roi = coordinates(value);
+				} else {
+					throw std::invalid_argument{
+					    "unknown key"};
+				}
+			}
+		} catch (const std::invalid_argument &e) {
+			throw std::runtime_error{"Could not parse \"" +
+			    std::string(pair) + "\" of image set " +
+			    identifier + " (" + e.what() + ')'};
+		}
+	}
+
+	if (hasEFSFields && !hasEFS)
+		throw std::runtime_error{"EFS without \"efs\" in image set " +
+		    identifier};
+	if (hasEFS)
+		md.efs = efs;
+
+	return (md);
+}
+
+template<typename T>
+T
+ELFT::Validation::Manifest::parseInteger(
+    const std::string_view value)
+{
+	T integer{};
+	const auto end = value.data() + value.size();
+	const auto [ptr, ec] = std::from_chars(value.data(), end, integer);
+	if ((ec != std::errc{}) || (ptr != end))
+		throw std::invalid_argument{'"' + std::string(value) +
+		    "\" is not a valid integer"};
+
+	return (integer);
+}
+
+uint64_t
+ELFT::Validation::Manifest::size(
+    const TemplateType templateType)
+    const
+{
+	switch (templateType) {
+	case TemplateType::Probe:
+		return (this->latents.size());
+	case TemplateType::Reference:
+		return (this->references.size());
+	default:
+		throw std::runtime_error{"Unknown TemplateType sent to "
+		    "Manifest::size()"};
+	}
+}
+
+std::vector<std::string_view>
+ELFT::Validation::Manifest::split(
+    const std::string_view s,
+    const char separator)
+{
+	std::vector<std::string_view> tokens{};
+	if (s.empty())
+		return (tokens);
+
+	std::string_view::size_type start{};
+	for (auto end = s.find(separator); end != std::string_view::npos;
+	    end = s.find(separator, start)) {
+		tokens.push_back(s.substr(start, end - start));
+		start = end + 1;
+	}
+	tokens.push_back(s.substr(start));
+
+	return (tokens);
+}
+
+ELFT::Validation::WorkQueue::WorkQueue(
+    const std::vector<uint64_t> &indicies,
+    const uint8_t numWorkers) :
+    indicies{indicies},
+    numWorkers{std::max<uint64_t>(numWorkers, 1)}
+{
+	static_assert(std::atomic<uint64_t>::is_always_lock_free,
+	    "WorkQueue requires a lock-free counter to share across fork()");
+
+	void *address = ::mmap(nullptr, sizeof(std::atomic<uint64_t>),
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (address == MAP_FAILED)
+		throw std::runtime_error{"Could not map shared memory for "
+		    "work queue (" + std::system_error(errno,
+		    std::system_category()).code().message() + ')'};
+	this->position = new (address) std::atomic<uint64_t>{0};
+}
+
+ELFT::Validation::WorkQueue::~WorkQueue()
+{
+	::munmap(this->position, sizeof(std::atomic<uint64_t>));
+}
+
+std::vector<uint64_t>
+ELFT::Validation::WorkQueue::next()
+{
+	const uint64_t size{this->indicies.size()};
+	uint64_t first{this->position->load(std::memory_order_relaxed)};
+	uint64_t last{};
+	do {
+		if (first >= size)
+			return {};
+
+		/* Claim a share of what remains, down to one at a time */
+		last = first + std::max<uint64_t>(1,
+		    (size - first) / (2 * this->numWorkers));
+	} while (!this->position->compare_exchange_weak(first, last,
+	    std::memory_order_relaxed));
+
+	return {std::next(this->indicies.cbegin(),
+	    static_cast<std::vector<uint64_t>::difference_type>(first)),
+	    std::next(this->indicies.cbegin(),
+	    static_cast<std::vector<uint64_t>::difference_type>(last))};
+}
+
+ELFT::Validation::Latencies::Latencies()
+{
+	static_assert(std::atomic<uint64_t>::is_always_lock_free,
+	    "Latencies requires lock-free counters to share across fork()");
+
+	void *address = ::mmap(nullptr, NumCalls * sizeof(Histogram),
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (address == MAP_FAILED)
+		throw std::runtime_error{"Could not map shared memory for "
+		    "latencies (" + std::system_error(errno,
+		    std::system_category()).code().message() + ')'};
+
+	this->histograms = static_cast<Histogram*>(address);
+	for (std::size_t i{0}; i < NumCalls; ++i)
+		new (&this->histograms[i]) Histogram{};
+}
+
+ELFT::Validation::Latencies::~Latencies()
+{
+	::munmap(this->histograms, NumCalls * sizeof(Histogram));
+}
+
+void
+ELFT::Validation::Latencies::record(
+    const Call call,
+    const std::chrono::steady_clock::time_point &start,
+    const std::chrono::steady_clock::time_point &stop,
+    const std::string &identifier)
+{
+	const auto elapsed = static_cast<uint64_t>(std::max<
+	    std::chrono::microseconds::rep>(microseconds(start, stop), 0));
+	auto &histogram = this->histograms[e2i(call)];
+
+	histogram.counts[getBucket(elapsed)].fetch_add(1,
+	    std::memory_order_relaxed);
+	uint64_t max{histogram.max.load(std::memory_order_relaxed)};
+	while ((elapsed > max) && !histogram.max.compare_exchange_weak(max,
+	    elapsed, std::memory_order_relaxed));
+
+	/* Most calls are not among the slowest and never take the lock */
+	if (elapsed < histogram.threshold.load(std::memory_order_relaxed))
+		return;
+
+	const auto faster = [](const Slow &lhs, const Slow &rhs) {
+		return (lhs.elapsed < rhs.elapsed);
+	};
+	auto &slowest = histogram.slowest;
+
+	while (histogram.lock.test_and_set(std::memory_order_acquire));
+
+	/* Fill unused entries first, then replace the fastest entry */
+	Slow *entry{nullptr};
+	if (histogram.numSlowest < NumSlowest) {
+		entry = &slowest[histogram.numSlowest++];
+	} else {
+		entry = &*std::min_element(slowest.begin(), slowest.end(),
+		    faster);
+		if (elapsed <= entry->elapsed)
+			entry = nullptr;
+	}
+	if (entry != nullptr) {
+		const auto length = std::min(identifier.size(),
+		    MaxIdentifierLength);
+		identifier.copy(entry->identifier, length);
+		entry->identifier[length] = '\0';
+		entry->elapsed = elapsed;
+
+		/* Once full, only calls slower than the fastest can enter */
+		if (histogram.numSlowest == NumSlowest)
+			histogram.threshold.store(std::min_element(
+			    slowest.cbegin(), slowest.cend(),
+			    faster)->elapsed + 1, std::memory_order_relaxed);
+	}
+
+	histogram.lock.clear(std::memory_order_release);
+}
+
+void
+ELFT::Validation::Latencies::writeSummary(
+    const std::filesystem::path &path)
+    const
+{
+	static const std::array<std::string, NumCalls> callNames{
+	    "createTemplate", "extractTemplateData",
+	    "createReferenceDatabase", "search", "extractCorrespondence",
+	    "exists", "insert", "remove",
+	    "ExtractionInterface::getImplementation",
+	    "SearchInterface::getImplementation"};
+	/* Percentiles, in tenths of a percent */
+	static const std::array<uint64_t, 4> percentiles{500, 900, 990, 999};
+
+	static const std::vector<Log::Column> columns{
+	    {"\"call\"", Log::Type::QuotedString},
+	    {"count", Log::Type::Integer},
+	    {"p50", Log::Type::Integer},
+	    {"p90", Log::Type::Integer},
+	    {"p99", Log::Type::Integer},
+	    {"p99.9", Log::Type::Integer},
+	    {"max", Log::Type::Integer},
+	    {"rank", Log::Type::Integer},
+	    {"\"identifier\"", Log::Type::QuotedString},
+	    {"elapsed", Log::Type::Integer}};
+	CSVLog log{path, columns};
+
+	for (std::size_t c{0}; c < NumCalls; ++c) {
+		const auto &histogram = this->histograms[c];
+
+		std::vector<uint64_t> counts(NumBuckets);
+		uint64_t total{0};
+		for (std::size_t b{0}; b < NumBuckets; ++b) {
+			counts[b] = histogram.counts[b].load(
+			    std::memory_order_relaxed);
+			total += counts[b];
+		}
+		if (total == 0)
+			continue;
+		const uint64_t max{histogram.max.load(
+		    std::memory_order_relaxed)};
+
+		/* Report the largest value in the bucket, like HDR */
+		std::array<uint64_t, percentiles.size()> values{};
+		for (std::size_t p{0}; p < percentiles.size(); ++p) {
+			const uint64_t rank{std::max<uint64_t>(1,
+			    ((total * percentiles[p]) + 999) / 1000)};
+			uint64_t seen{0};
+			std::size_t b{0};
+			for (; b < (NumBuckets - 1); ++b) {
+				seen += counts[b];
+				if (seen >= rank)
+					break;
+			}
+			values[p] = std::min(getBucketLimit(b), max);
+		}
+
+		std::vector<Slow> slowest(histogram.slowest.cbegin(),
+		    std::next(histogram.slowest.cbegin(),
+		    static_cast<std::ptrdiff_t>(histogram.numSlowest)));
+		std::sort(slowest.begin(), slowest.end(),
+		    [](const Slow &lhs, const Slow &rhs) {
+			return (lhs.elapsed > rhs.elapsed);
+		    });
+
+		for (std::vector<Slow>::size_type r{0}; r < slowest.size();
+		    ++r) {
+			log.quoted(callNames[c]).integer(total);
+			for (const auto &value : values)
+				log.integer(value);
+			log.integer(max).integer(r + 1).
+			    quoted(slowest[r].identifier).
+			    integer(slowest[r].elapsed);
+		}
+	}
+
+	log.flush();
+}
+
+std::size_t
+ELFT::Validation::Latencies::getBucket(
+    const uint64_t value)
+    noexcept
+{
+	static constexpr uint64_t subBuckets{uint64_t{1} << SubBucketBits};
+	if (value < subBuckets)
+		return (value);
+
+	/* Magnitude is floor(log2(value)) */
+	uint8_t magnitude{SubBucketBits};
+	while ((value >> magnitude) > 1)
+		++magnitude;
+	const uint8_t shift = static_cast<uint8_t>(magnitude - SubBucketBits);
+
+	return ((static_cast<std::size_t>(shift + 1) << SubBucketBits) +
+	    ((value >> shift) - subBuckets));
+}
+
+uint64_t
+ELFT::Validation::Latencies::getBucketLimit(
+    const std::size_t bucket)
+    noexcept
+{
+	static constexpr uint64_t subBuckets{uint64_t{1} << SubBucketBits};
+	if (bucket < subBuckets)
+		return (bucket);
+
+	const auto shift = (bucket >> SubBucketBits) - 1;
+	const uint64_t lowest{((bucket & (subBuckets - 1)) + subBuckets) <<
+	    shift};
+	return (lowest + ((uint64_t{1} << shift) - 1));
+}
+
+ELFT::Validation::HardwareCounters::HardwareCounters(
+    const bool enabled,
+    const std::size_t driverThreads) :
+    enabled{enabled},
+    driverThreads{driverThreads}
+{
+	if (!this->enabled)
+		return;
+
+	static const std::array<std::pair<uint32_t, uint64_t>, NumEvents>
+	    configs{{
+	    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+	    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+	    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+		(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		(PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+	    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+	    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+		(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		(PERF_COUNT_HW_CACHE_RESULT_MISS << 16)}}};
+
+	/* The first event that can be counted leads the group */
+	std::string reason{};
+	for (std::size_t e{0}; e < NumEvents; ++e) {
+		perf_event_attr attr{};
+		attr.size = sizeof(attr);
+		attr.type = configs[e].first;
+		attr.config = configs[e].second;
+		attr.read_format = PERF_FORMAT_GROUP;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+
+		/* Calling thread, any CPU */
+		const auto fd = static_cast<int>(::syscall(
+		    SYS_perf_event_open, &attr, 0, -1, this->leader,
+		    PERF_FLAG_FD_CLOEXEC));
+		if (fd == -1) {
+			reason = std::strerror(errno);
+			continue;
+		}
+
+		if (this->leader == -1)
+			this->leader = fd;
+		this->fds.push_back(fd);
+		this->events.push_back(static_cast<Event>(e));
+	}
+
+	/* Warn once per process, so a missing counter is not a mystery */
+	static std::once_flag warned{};
+	if (this->fds.size() < NumEvents)
+		std::call_once(warned, [this, &reason]() {
+			std::cerr << "Hardware counters: only " <<
+			    this->fds.size() << " of " << NumEvents <<
+			    " events can be counted (" << reason << "); "
+			    "logging NA for the rest\n";
+		});
+}
+
+ELFT::Validation::HardwareCounters::~HardwareCounters()
+{
+	/* Close group members before the leader */
+	for (auto fd = this->fds.crbegin(); fd != this->fds.crend(); ++fd)
+		::close(*fd);
+}
+
+ELFT::Validation::HardwareCounters::Counts
+ELFT::Validation::HardwareCounters::read()
+    const
+{
+	Counts counts{};
+	if (this->leader == -1)
+		return (counts);
+
+	/* PERF_FORMAT_GROUP: number of events, then a value for each */
+	std::array<uint64_t, NumEvents + 1> values{};
+	const auto size = ::read(this->leader, values.data(),
+	    sizeof(values));
+	if ((size < static_cast<ssize_t>(sizeof(uint64_t))) ||
+	    (values[0] != this->events.size()))
+		return (counts);
+
+	for (std::vector<Event>::size_type i{0}; i < this->events.size(); ++i)
+		counts[e2i(this->events[i])] = values[i + 1];
+	return (counts);
+}
+
+void
+ELFT::Validation::HardwareCounters::log(
+    Log &log,
+    const Counts &before,
+    const Counts &after)
+    const
+{
+	if (!this->enabled)
+		return;
+
+	/* Only the calling thread was counted, so work could be missing */
+	const bool missed{this->hasImplementationThreads()};
+	for (std::size_t e{0}; e < NumEvents; ++e) {
+		if (!missed && before[e] && after[e])
+			log.integer(*after[e] - *before[e]);
+		else
+			log.na();
+	}
+}
+
+bool
+ELFT::Validation::HardwareCounters::hasImplementationThreads()
+    const
+{
+	std::error_code error{};
+	std::size_t threads{0};
+	for (std::filesystem::directory_iterator task{"/proc/self/task",
+	    error}; !error && (task != std::filesystem::directory_iterator{});
+	    task.increment(error))
+		++threads;
+	if (error)
+		return (false);
+
+	return (threads > (this->driverThreads +
+	    ResourceUsage::excludedThreads()));
+}
+
+std::vector<ELFT::Validation::Log::Column>
+ELFT::Validation::HardwareCounters::addColumns(
+    const std::vector<Log::Column> &columns)
+{
+	static const std::vector<Log::Column> counterColumns{
+	    {"cycles", Log::Type::Integer},
+	    {"instructions", Log::Type::Integer},
+	    {"llc_misses", Log::Type::Integer},
+	    {"branch_misses", Log::Type::Integer},
+	    {"dtlb_misses", Log::Type::Integer}};
+
+	auto elapsed = std::find_if(columns.cbegin(), columns.cend(),
+	    [](const Log::Column &column) {
+		return (column.name == "elapsed");
+	    });
+	if (elapsed == columns.cend())
+		throw std::logic_error{"Hardware counters logged without an "
+		    "elapsed column"};
+
+	std::vector<Log::Column> added(columns.cbegin(), std::next(elapsed));
+	added.insert(added.cend(), counterColumns.cbegin(),
+	    counterColumns.cend());
+	added.insert(added.cend(), std::next(elapsed), columns.cend());
+	return (added);
+}
+
+std::atomic<int64_t> ELFT::Validation::ResourceUsage::allocations{0};
+std::atomic<int64_t> ELFT::Validation::ResourceUsage::allocatedBytes{0};
+thread_local bool ELFT::Validation::ResourceUsage::excludedThread{false};
+std::mutex ELFT::Validation::ResourceUsage::excludedMutex{};
+std::vector<clockid_t> ELFT::Validation::ResourceUsage::excludedClocks{};
+int64_t ELFT::Validation::ResourceUsage::exitedCPUTime{0};
+
+ELFT::Validation::ResourceUsage::ResourceUsage(
+    const bool enabled,
+    const bool concurrent) :
+    enabled{enabled},
+    concurrent{concurrent},
+    pageSize{::sysconf(_SC_PAGESIZE)}
+{
+	if (this->enabled)
+		this->statm = ::open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+}
+
+ELFT::Validation::ResourceUsage::~ResourceUsage()
+{
+	if (this->statm != -1)
+		::close(this->statm);
+}
+
+ELFT::Validation::ResourceUsage::Counts
+ELFT::Validation::ResourceUsage::read()
+    const
+{
+	Counts counts{};
+	if (!this->enabled || this->concurrent)
+		return (counts);
+
+	/*
+	 * Excluded threads that run between reading their clocks and
+	 * getrusage() (e.g., while this thread is preempted) would skew CPU
+	 * time, so bracket getrusage() and retry when they ran in between.
+	 */
+	static constexpr int64_t MaxSkew{50};
+	struct rusage usage{};
+	int64_t excluded{};
+	int rv{-1};
+	for (int attempt{0}; attempt < 3; ++attempt) {
+		const auto first = excludedCPUTime();
+		rv = ::getrusage(RUSAGE_SELF, &usage);
+		const auto last = excludedCPUTime();
+		excluded = first + ((last - first) / 2);
+		if ((last - first) <= MaxSkew)
+			break;
 	}
+
+	if (rv == 0) {
+		counts.cpuTime = ((usage.ru_utime.tv_sec +
+		    usage.ru_stime.tv_sec) * 1'000'000) +
+		    usage.ru_utime.tv_usec + usage.ru_stime.tv_usec -
+		    excluded;
+		/* Linux reports ru_maxrss in KiB */
+		counts.peakRSS = usage.ru_maxrss * 1024;
+		counts.minorFaults = usage.ru_minflt;
+		counts.majorFaults = usage.ru_majflt;
+	}
+
+	/* "size resident shared text lib data dt", in pages */
+	if (this->statm != -1) {
+		std::array<char, 128> buffer{};
+		if (::pread(this->statm, buffer.data(), buffer.size() - 1,
+		    0) > 0) {
+			int64_t size{}, resident{};
+			if (std::sscanf(buffer.data(), "%" SCNd64 " %" SCNd64,
+			    &size, &resident) == 2)
+				counts.rss = resident * this->pageSize;
+		}
+	}
+
+#ifdef ELFT_VALIDATION_COUNT_ALLOCATIONS
+	counts.allocations = allocations.load(std::memory_order_relaxed);
+	counts.allocatedBytes = allocatedBytes.load(
+	    std::memory_order_relaxed);
+#endif /* ELFT_VALIDATION_COUNT_ALLOCATIONS */
+
+	return (counts);
+}
+
+void
+ELFT::Validation::ResourceUsage::log(
+    Log &log,
+    const Counts &before,
+    const Counts &after)
+    const
+{
+	if (!this->enabled)
+		return;
+
+	for (const auto value : {&Counts::cpuTime, &Counts::allocations,
+	    &Counts::allocatedBytes, &Counts::rss, &Counts::peakRSS,
+	    &Counts::minorFaults, &Counts::majorFaults}) {
+		if ((before.*value) && (after.*value))
+			log.integer(*(after.*value) - *(before.*value));
+		else
+			log.na();
+	}
+}
+
+std::vector<ELFT::Validation::Log::Column>
+ELFT::Validation::ResourceUsage::addColumns(
+    const std::vector<Log::Column> &columns)
+{
+	static const std::vector<Log::Column> usageColumns{
+	    {"cpu_time", Log::Type::Integer},
+	    {"allocations", Log::Type::Integer},
+	    {"allocated_bytes", Log::Type::Integer},
+	    {"rss_delta", Log::Type::Integer},
+	    {"peak_rss_delta", Log::Type::Integer},
+	    {"minor_faults", Log::Type::Integer},
+	    {"major_faults", Log::Type::Integer}};
+
+	auto elapsed = std::find_if(columns.cbegin(), columns.cend(),
+	    [](const Log::Column &column) {
+		return (column.name == "elapsed");
+	    });
+	if (elapsed == columns.cend())
+		throw std::logic_error{"Resource usage logged without an "
+		    "elapsed column"};
+
+	std::vector<Log::Column> added(columns.cbegin(), std::next(elapsed));
+	added.insert(added.cend(), usageColumns.cbegin(),
+	    usageColumns.cend());
+	added.insert(added.cend(), std::next(elapsed), columns.cend());
+	return (added);
+}
+
+void
+ELFT::Validation::ResourceUsage::exclude()
+{
+	/* Before registering, which allocates */
+	excludedThread = true;
+
+	/* Registers on first call, and moves the time to exited on exit */
+	struct Registration
+	{
+		Registration()
+		{
+			if (::pthread_getcpuclockid(::pthread_self(),
+			    &this->clock) != 0)
+				return;
+
+			std::lock_guard<std::mutex> lock{excludedMutex};
+			excludedClocks.push_back(this->clock);
+			this->registered = true;
+		}
+
+		~Registration()
+		{
+			if (!this->registered)
+				return;
+
+			struct timespec ts{};
+			const bool timed{::clock_gettime(this->clock,
+			    &ts) == 0};
+
+			std::lock_guard<std::mutex> lock{excludedMutex};
+			excludedClocks.erase(std::remove(
+			    excludedClocks.begin(), excludedClocks.end(),
+			    this->clock), excludedClocks.end());
+			if (timed)
+				exitedCPUTime += (ts.tv_sec * 1'000'000) +
+				    (ts.tv_nsec / 1'000);
+		}
+
+		clockid_t clock{};
+		bool registered{false};
+	};
+
+	/* Threads inherited by a child of fork() are gone */
+	static std::once_flag registered{};
+	std::call_once(registered, []() {
+		::pthread_atfork([]() { excludedMutex.lock(); },
+		    []() { excludedMutex.unlock(); },
+		    []() {
+			excludedMutex.unlock();
+			excludedClocks.clear();
+			exitedCPUTime = 0;
+		    });
+	});
+
+	thread_local const Registration registration{};
+}
+
+std::size_t
+ELFT::Validation::ResourceUsage::excludedThreads()
+{
+	std::lock_guard<std::mutex> lock{excludedMutex};
+	return (excludedClocks.size());
+}
+
+int64_t
+ELFT::Validation::ResourceUsage::excludedCPUTime()
+{
+	std::lock_guard<std::mutex> lock{excludedMutex};
+	int64_t cpuTime{exitedCPUTime};
+	for (const auto clock : excludedClocks) {
+		struct timespec ts{};
+		if (::clock_gettime(clock, &ts) == 0)
+			cpuTime += (ts.tv_sec * 1'000'000) +
+			    (ts.tv_nsec / 1'000);
+	}
+
+	return (cpuTime);
+}
+
+ELFT::Validation::SyntheticGallery::SyntheticGallery(
+    std::shared_ptr<ExtractionInterface> impl,
+    const uint64_t seed) :
+    impl{impl},
+    seed{seed}
+{
+
+}
+
+std::string
+ELFT::Validation::SyntheticGallery::getIdentifier(
+    const uint64_t index)
+{
+	std::ostringstream identifier{};
+	identifier << "synthetic" << std::setw(10) << std::setfill('0') <<
+	    index;
+	return (identifier.str());
+}
+
+ELFT::Validation::Samples
+ELFT::Validation::SyntheticGallery::getSamples(
+    const uint64_t index)
+    const
+{
+	std::seed_seq sequence{this->seed & UINT32_MAX, this->seed >> 32,
+	    index & UINT32_MAX, index >> 32};
+	std::mt19937_64 rng{sequence};
+
+	Samples samples{};
+	const auto add = [&samples, &rng](
+	    const FrictionRidgeGeneralizedPosition frgp,
+	    const Impression imp,
+	    const uint32_t width,
+	    const uint32_t height,
+	    const double meanMinutia) {
+		EFS efs{};
+		efs.identifier = static_cast<uint8_t>(samples.size());
+		efs.imp = imp;
+		efs.frct = FrictionRidgeCaptureTechnology::OpticalTIRBright;
+		efs.frgp = frgp;
+		efs.roi = std::vector<Coordinate>{{0, 0}, {width - 1, 0},
+		    {width - 1, height - 1}, {0, height - 1}};
+
+		std::normal_distribution<double> count{meanMinutia,
+		    meanMinutia / 4};
+		std::uniform_int_distribution<uint32_t> x{0, width - 1};
+		std::uniform_int_distribution<uint32_t> y{0, height - 1};
+		std::uniform_int_distribution<uint16_t> theta{0, 359};
+		std::bernoulli_distribution bifurcation{0.5};
+
+		const auto numMinutia = static_cast<std::size_t>(std::clamp(
+		    std::lround(count(rng)), 5L, std::lround(meanMinutia * 3)));
+		std::vector<Minutia> minutia{};
+		minutia.reserve(numMinutia);
+		for (std::size_t m{0}; m < numMinutia; ++m)
+			minutia.emplace_back(Coordinate{x(rng), y(rng)},
+			    theta(rng), bifurcation(rng) ?
+			    MinutiaType::Bifurcation :
+			    MinutiaType::RidgeEnding);
+		efs.minutia = std::move(minutia);
+
+		samples.emplace_back(std::nullopt, std::move(efs));
+	};
+
+	/*
+	 * Share of identities with rolled ten-prints, plus plain slaps, plus
+	 * palms, and with only some rolled fingers. Sizes are 500 PPI.
+	 */
+	std::discrete_distribution<int> profile{50, 25, 20, 5};
+	const auto captures = profile(rng);
+
+	std::bernoulli_distribution present{captures == 3 ? 0.5 : 1.0};
+	for (int finger{e2i(FrictionRidgeGeneralizedPosition::RightThumb)};
+	    finger <= e2i(FrictionRidgeGeneralizedPosition::LeftLittle);
+	    ++finger)
+		if (present(rng))
+			add(static_cast<FrictionRidgeGeneralizedPosition>(
+			    finger), Impression::RolledContact, 800, 750, 70);
+	if (samples.empty())
+		add(FrictionRidgeGeneralizedPosition::RightIndex,
+		    Impression::RolledContact, 800, 750, 70);
+
+	if ((captures == 1) || (captures == 2)) {
+		add(FrictionRidgeGeneralizedPosition::RightFour,
+		    Impression::PlainContact, 1600, 1500, 160);
+		add(FrictionRidgeGeneralizedPosition::LeftFour,
+		    Impression::PlainContact, 1600, 1500, 160);
+		add(FrictionRidgeGeneralizedPosition::RightAndLeftThumbs,
+		    Impression::PlainContact, 1600, 1500, 80);
+	}
+
+	if (captures == 2) {
+		add(FrictionRidgeGeneralizedPosition::RightFullPalm,
+		    Impression::PlainContact, 2000, 2500, 800);
+		add(FrictionRidgeGeneralizedPosition::LeftFullPalm,
+		    Impression::PlainContact, 2000, 2500, 800);
+		add(FrictionRidgeGeneralizedPosition::RightWritersPalm,
+		    Impression::PlainContact, 1000, 2000, 250);
+		add(FrictionRidgeGeneralizedPosition::LeftWritersPalm,
+		    Impression::PlainContact, 1000, 2000, 250);
+	}
+
+	return (samples);
+}
+
+std::vector<std::byte>
+ELFT::Validation::SyntheticGallery::createTemplate(
+    const uint64_t index)
+    const
+{
+	const auto identifier = getIdentifier(index);
+	CreateTemplateResult result{};
+	try {
+		result = this->impl->createTemplate(TemplateType::Reference,
+		    identifier, this->getSamples(index));
+	} catch (const std::exception &e) {
+		throw std::runtime_error{"Exception while creating synthetic "
+		    "template \"" + identifier + "\" (" +
+		    std::string(e.what()) + ")"};
+	} catch (...) {
+		throw std::runtime_error{"Unknown exception while creating "
+		    "synthetic template \"" + identifier + '"'};
+	}
+	if (!result.status)
+		throw std::runtime_error{"Could not create synthetic template "
+		    "\"" + identifier + "\" (" +
+		    result.status.message.value_or("") + ")"};
+
+	return (std::move(result.data));
+}
+
+ELFT::Validation::SampleLoader::SampleLoader(
+    WorkQueue &queue,
+    const Arguments &args,
+    const std::size_t depth) :
+    queue{queue},
+    args{args},
+    depth{std::max<std::size_t>(depth, 1)},
+    loader{&SampleLoader::load, this}
+{
+
+}
+
+ELFT::Validation::SampleLoader::~SampleLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping = true;
+	}
+	this->changed.notify_all();
+	this->loader.join();
+}
+
+std::optional<ELFT::Validation::SampleLoader::Entry>
+ELFT::Validation::SampleLoader::next()
+{
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->changed.wait(lock, [this]() {
+		return (!this->loaded.empty() || this->finished);
+	});
+	if (this->loaded.empty()) {
+		if (this->error)
+			std::rethrow_exception(this->error);
+		return (std::nullopt);
+	}
+
+	Entry entry{std::move(this->loaded.front())};
+	this->loaded.pop_front();
+	lock.unlock();
+	this->changed.notify_all();
+
+	return (entry);
+}
+
+void
+ELFT::Validation::SampleLoader::load()
+{
+	ResourceUsage::exclude();
+
+	try {
+		for (auto batch = this->queue.next(); !batch.empty();
+		    batch = this->queue.next()) {
+			decltype(batch)::size_type advised{0};
+			for (decltype(batch)::size_type i{0}; i < batch.size();
+			    ++i) {
+				/* Keep the kernel `depth` image sets ahead */
+				for (; advised < std::min(batch.size(),
+				    i + this->depth); ++advised)
+					this->advise(batch[advised]);
+
+				auto samples = readSamples(batch[i],
+				    this->args);
+
+				std::unique_lock<std::mutex> lock{this->mutex};
+				this->changed.wait(lock, [this]() {
+					return (this->stopping ||
+					    (this->loaded.size() <
+					    this->depth));
+				});
+				if (this->stopping)
+					return;
+				this->loaded.push_back({batch[i],
+				    std::move(samples)});
+				lock.unlock();
+				this->changed.notify_all();
+			}
+		}
+	} catch (...) {
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->error = std::current_exception();
+	}
+
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->finished = true;
+	this->changed.notify_all();
+
+	/*
+	 * Stay registered with ResourceUsage until joined, so an exiting
+	 * loader is never counted as a thread of the implementation.
+	 */
+	this->changed.wait(lock, [this]() {
+		return (this->stopping);
+	});
+}
+
+void
+ELFT::Validation::SampleLoader::advise(
+    const uint64_t imageIndex)
+    const
+{
+	/* Only advisory, so errors are left for readSamples() to report */
+	const auto imageSet = getImageSet(this->args, imageIndex,
+	    *this->args.templateType);
+	for (const auto &md : imageSet.second) {
+		if (!md.filename)
+			continue;
+
+		const int fd = ::open((this->args.imageDir /
+		    *md.filename).c_str(), O_RDONLY);
+		if (fd == -1)
+			continue;
+		::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+		::close(fd);
+	}
+}
+
+ELFT::Validation::LogSink::LogSink(
+    const std::filesystem::path &path,
+    const std::size_t numBuffers,
+    const std::size_t bufferSize) :
+    path{path},
+    buffers(std::max<std::size_t>(numBuffers, 2))
+{
+	this->fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC |
+	    O_CLOEXEC, 0644);
+	if (this->fd == -1)
+		throw std::runtime_error{"Could not create " + path.string()};
+
+	/* Reserve up front so appends never allocate */
+	for (std::vector<std::vector<char>>::size_type i{0};
+	    i < this->buffers.size(); ++i) {
+		this->buffers[i].reserve(std::max<std::size_t>(bufferSize, 1));
+		if (i != this->current)
+			this->available.push_back(i);
+	}
+
+	this->writer = std::thread{&LogSink::drain, this};
+
+	/* Don't return until the writer is excluded from per-call usage */
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->changed.wait(lock, [this]() {
+		return (this->started);
+	});
+}
+
+ELFT::Validation::LogSink::~LogSink()
+{
+	try {
+		this->flush();
+	} catch (...) {}
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping = true;
+	}
+	this->changed.notify_all();
+	this->writer.join();
+
+	::close(this->fd);
+}
+
+void
+ELFT::Validation::LogSink::write(
+    const void *data,
+    std::size_t size)
+{
+	auto bytes = static_cast<const char*>(data);
+	while (size > 0) {
+		auto &buffer = this->buffers[this->current];
+		const auto count = std::min(size,
+		    buffer.capacity() - buffer.size());
+		buffer.insert(buffer.cend(), bytes, bytes + count);
+		bytes += count;
+		size -= count;
+
+		if (buffer.size() == buffer.capacity())
+			this->submit();
+	}
+}
+
+void
+ELFT::Validation::LogSink::write(
+    const std::string &data)
+{
+	this->write(data.data(), data.size());
+}
+
+void
+ELFT::Validation::LogSink::flush()
+{
+	if (!this->buffers[this->current].empty())
+		this->submit();
+
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->changed.wait(lock, [this]() {
+		return (this->available.size() == (this->buffers.size() - 1));
+	});
+	if (!this->error.empty())
+		throw std::runtime_error{this->error};
+}
+
+const std::filesystem::path&
+ELFT::Validation::LogSink::getPath()
+    const
+    noexcept
+{
+	return (this->path);
+}
+
+void
+ELFT::Validation::LogSink::submit()
+{
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->pending.push_back(this->current);
+	this->changed.notify_all();
+
+	this->changed.wait(lock, [this]() {
+		return (!this->available.empty());
+	});
+	this->current = this->available.front();
+	this->available.pop_front();
+
+	if (!this->error.empty())
+		throw std::runtime_error{this->error};
+}
+
+void
+ELFT::Validation::LogSink::drain()
+{
+	ResourceUsage::exclude();
+
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->started = true;
+	this->changed.notify_all();
+	while (true) {
+		this->changed.wait(lock, [this]() {
+			return (this->stopping || !this->pending.empty());
+		});
+		if (this->pending.empty())
+			return;
+
+		const auto index = this->pending.front();
+		this->pending.pop_front();
+		const bool failed{!this->error.empty()};
+		lock.unlock();
+
+		/* Nothing more is written after the first failure */
+		std::string message{};
+		auto &buffer = this->buffers[index];
+		for (std::size_t offset{0}; !failed &&
+		    (offset < buffer.size());) {
+			const auto count = ::write(this->fd,
+			    buffer.data() + offset, buffer.size() - offset);
+			if (count == -1) {
+				if (errno == EINTR)
+					continue;
+				message = "Error writing to " +
+				    this->path.string() + " (" +
+				    std::strerror(errno) + ")";
+				break;
+			}
+			offset += static_cast<std::size_t>(count);
+		}
+		buffer.clear();
+
+		lock.lock();
+		if (!message.empty() && this->error.empty())
+			this->error = message;
+		this->available.push_back(index);
+		this->changed.notify_all();
+	}
+}
+
+ELFT::Validation::Log::Log(
+    const std::vector<Column> &columns) :
+    columns{columns}
+{
+	if (this->columns.empty())
+		throw std::invalid_argument{"Log must have columns"};
+}
+
+ELFT::Validation::Log::~Log() = default;
+
+const std::vector<ELFT::Validation::Log::Column>&
+ELFT::Validation::Log::getColumns()
+    const
+    noexcept
+{
+	return (this->columns);
+}
+
+std::size_t
+ELFT::Validation::Log::getColumnIndex()
+    const
+    noexcept
+{
+	return (this->column);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::integer(
+    const int64_t value)
+{
+	this->check(Type::Integer);
+	this->writeInteger(value);
+	this->advance();
+	return (*this);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::real(
+    const double value)
+{
+	this->check(Type::Real);
+	this->writeReal(value);
+	this->advance();
+	return (*this);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::string(
+    const std::string &value)
+{
+	this->check(Type::String);
+	this->writeString(value);
+	this->advance();
+	return (*this);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::quoted(
+    const std::string &value)
+{
+	this->check(Type::QuotedString);
+	this->writeString(value);
+	this->advance();
+	return (*this);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::tuples(
+    const std::vector<Coordinate> &value)
+{
+	std::vector<int64_t> flattened{};
+	flattened.reserve(value.size() * 2);
+	for (const auto &c : value) {
+		flattened.push_back(c.x);
+		flattened.push_back(c.y);
+	}
+	return (this->tuples(flattened, 2));
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::tuples(
+    const std::vector<Minutia> &value)
+{
+	std::vector<int64_t> flattened{};
+	flattened.reserve(value.size() * 4);
+	for (const auto &m : value) {
+		flattened.push_back(m.coordinate.x);
+		flattened.push_back(m.coordinate.y);
+		flattened.push_back(m.theta);
+		flattened.push_back(e2i(m.type));
+	}
+	return (this->tuples(flattened, 4));
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::tuples(
+    const std::vector<int64_t> &values,
+    const uint8_t width)
+{
+	this->check(Type::Tuples);
+	if ((this->columns[this->column].width != width) ||
+	    ((values.size() % width) != 0))
+		throw std::logic_error{"Tuples of " + ts(width) + " logged "
+		    "to column " + this->columns[this->column].name};
+	this->writeTuples(values);
+	this->advance();
+	return (*this);
+}
+
+ELFT::Validation::Log&
+ELFT::Validation::Log::na(
+    const std::size_t count)
+{
+	if (count > (this->columns.size() - this->column))
+		throw std::logic_error{"Logged " + ts(count) + " NA, but "
+		    "only " + ts(this->columns.size() - this->column) + " columns "
+		    "remain"};
+
+	for (std::size_t i{0}; i < count; ++i) {
+		this->writeNA();
+		this->advance();
+	}
+	return (*this);
+}
+
+void
+ELFT::Validation::Log::check(
+    const Type type)
+    const
+{
+	if (this->columns[this->column].type != type)
+		throw std::logic_error{"Value of type " + e2i2s(type) +
+		    " logged to column " + this->columns[this->column].name};
+}
+
+void
+ELFT::Validation::Log::advance()
+{
+	if (++this->column == this->columns.size()) {
+		this->column = 0;
+		this->endRow();
+	}
+}
+
+ELFT::Validation::CSVLog::CSVLog(
+    const std::filesystem::path &path,
+    const std::vector<Column> &columns) :
+    Log{columns},
+    file{path}
+{
+	for (const auto &column : columns) {
+		if (!this->row.empty())
+			this->row += ',';
+		this->row += column.name;
+	}
+	this->endRow();
+}
+
+void
+ELFT::Validation::CSVLog::flush()
+{
+	if (this->getColumnIndex() != 0)
+		throw std::logic_error{"Flushed " +
+		    this->file.getPath().string() + " in the middle of a row"};
+
+	this->file.flush();
+}
+
+void
+ELFT::Validation::CSVLog::writeInteger(
+    const int64_t value)
+{
+	this->separate();
+	this->row += ts(value);
+}
+
+void
+ELFT::Validation::CSVLog::writeReal(
+    const double value)
+{
+	this->separate();
+	this->row += std::to_string(value);
+}
+
+void
+ELFT::Validation::CSVLog::writeString(
+    const std::string &value)
+{
+	this->separate();
+	if (this->getColumns()[this->getColumnIndex()].type ==
+	    Type::QuotedString)
+		this->row += sanitizeMessage(value);
+	else
+		this->row += value;
+}
+
+void
+ELFT::Validation::CSVLog::writeTuples(
+    const std::vector<int64_t> &values)
+{
+	this->separate();
+
+	/* Same format as splice() */
+	const auto width = this->getColumns()[this->getColumnIndex()].width;
+	for (std::vector<int64_t>::size_type i{0}; i < values.size(); ++i) {
+		if (i != 0)
+			this->row += ((i % width) == 0) ? '-' : ';';
+		this->row += ts(values[i]);
+	}
+}
+
+void
+ELFT::Validation::CSVLog::writeNA()
+{
+	this->separate();
+	this->row += NA;
+}
+
+void
+ELFT::Validation::CSVLog::endRow()
+{
+	this->row += '\n';
+	this->file.write(this->row);
+	this->row.clear();
+}
+
+void
+ELFT::Validation::CSVLog::separate()
+{
+	if (this->getColumnIndex() != 0)
+		this->row += ',';
+}
+
+ELFT::Validation::ColumnarLog::ColumnarLog(
+    const std::filesystem::path &path,
+    const std::vector<Column> &columns) :
+    Log{columns},
+    file{path},
+    values(columns.size()),
+    present(columns.size())
+{
+	const uint32_t numColumns{static_cast<uint32_t>(columns.size())};
+	this->file.write(Magic, sizeof(Magic));
+	this->file.write(&Version, sizeof(Version));
+	this->file.write(&numColumns, sizeof(numColumns));
+	for (const auto &column : columns) {
+		const uint8_t type{e2i(column.type)};
+		const uint16_t nameLength{static_cast<uint16_t>(
+		    column.name.size())};
+		this->file.write(&type, sizeof(type));
+		this->file.write(&column.width, sizeof(column.width));
+		this->file.write(&nameLength, sizeof(nameLength));
+		this->file.write(column.name.data(), nameLength);
+	}
+
+	for (std::vector<Column>::size_type c{0}; c < columns.size(); ++c) {
+		this->values[c].reserve(ChunkRows);
+		this->present[c].resize((ChunkRows + 7) / 8);
+	}
+}
+
+ELFT::Validation::ColumnarLog::~ColumnarLog()
+{
+	try {
+		this->flush();
+	} catch (...) {}
+}
+
+void
+ELFT::Validation::ColumnarLog::flush()
+{
+	if (this->getColumnIndex() != 0)
+		throw std::logic_error{"Flushed " +
+		    this->file.getPath().string() + " in the middle of a row"};
+
+	this->writeChunk();
+	this->file.flush();
+}
+
+void
+ELFT::Validation::ColumnarLog::writeInteger(
+    const int64_t value)
+{
+	this->store(static_cast<uint64_t>(value));
+}
+
+void
+ELFT::Validation::ColumnarLog::writeReal(
+    const double value)
+{
+	static_assert(sizeof(double) == sizeof(uint64_t));
+	uint64_t bits{};
+	std::memcpy(&bits, &value, sizeof(bits));
+	this->store(bits);
+}
+
+void
+ELFT::Validation::ColumnarLog::writeString(
+    const std::string &value)
+{
+	this->store(this->allocate(value.data(), value.size()));
+}
+
+void
+ELFT::Validation::ColumnarLog::writeTuples(
+    const std::vector<int64_t> &values)
+{
+	this->store(this->allocate(values.data(),
+	    values.size() * sizeof(int64_t)));
+}
+
+void
+ELFT::Validation::ColumnarLog::writeNA()
+{
+	this->values[this->getColumnIndex()].push_back(0);
+}
+
+void
+ELFT::Validation::ColumnarLog::endRow()
+{
+	if ((++this->rows == ChunkRows) || (this->heap.size() >= ChunkHeapSize))
+		this->writeChunk();
+}
+
+void
+ELFT::Validation::ColumnarLog::writeChunk()
+{
+	if (this->rows == 0)
+		return;
+
+	const uint32_t heapSize{static_cast<uint32_t>(this->heap.size())};
+	this->file.write(&this->rows, sizeof(this->rows));
+	this->file.write(&heapSize, sizeof(heapSize));
+	for (std::vector<std::vector<uint64_t>>::size_type c{0};
+	    c < this->values.size(); ++c) {
+		this->file.write(this->present[c].data(), (this->rows + 7) / 8);
+		this->file.write(this->values[c].data(),
+		    this->rows * sizeof(uint64_t));
+
+		this->values[c].clear();
+		std::fill(this->present[c].begin(), this->present[c].end(), 0);
+	}
+	this->file.write(this->heap.data(), heapSize);
+
+	this->rows = 0;
+	this->heap.clear();
+}
+
+void
+ELFT::Validation::ColumnarLog::store(
+    const uint64_t value)
+{
+	const auto c = this->getColumnIndex();
+	this->values[c].push_back(value);
+	this->present[c][this->rows / 8] |= static_cast<uint8_t>(
+	    1u << (this->rows % 8));
+}
+
+uint64_t
+ELFT::Validation::ColumnarLog::allocate(
+    const void *data,
+    const std::size_t size)
+{
+	const uint64_t offset{this->heap.size()};
+	if ((offset + size) > UINT32_MAX)
+		throw std::runtime_error{"Value too large for " +
+		    this->file.getPath().string()};
+
+	const auto bytes = static_cast<const std::byte*>(data);
+	this->heap.insert(this->heap.cend(), bytes, bytes + size);
+	return (offset | (static_cast<uint64_t>(size) << 32));
+}
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+	if (!((ELFT::API_MAJOR_VERSION == 0) &&
+	    (ELFT::API_MINOR_VERSION == 0) &&
+	    (ELFT::API_PATCH_VERSION == 2))) {
+		std::cerr << "Incompatible API version encountered.\n "
+		    "- Validation: 0.0.2\n - Participant: " <<
+		    ELFT::API_MAJOR_VERSION << '.' <<
+		    ELFT::API_MINOR_VERSION << '.' <<
+		    ELFT::API_PATCH_VERSION << '\n';
+		std::cerr << "Rebuild your core library with the latest "
+		    "elft.h\n";
+		return (EXIT_FAILURE);
+	}
+
+	ELFT::Validation::Arguments args{};
+	try {
+		args = ELFT::Validation::parseArguments(argc, argv);
+	} catch (const std::exception &e) {
+		std::cerr << "[ERROR] " << e.what() << '\n';
+		std::cerr << ELFT::Validation::getUsageString(argv[0]) <<
+		    '\n';
+		return (EXIT_FAILURE);
+	}
+
+	try {
+		return (ELFT::Validation::dispatchOperation(args));
+	} catch (const std::exception &e) {
+		std::cerr << "[ERROR] " << e.what() << '\n';
+		return (EXIT_FAILURE);
+	} catch (...) {
+		std::cerr << "[ERROR] Caught non-standard exception." << '\n';
+		return (EXIT_FAILURE);
+	}
+}
+
+#ifdef ELFT_VALIDATION_COUNT_ALLOCATIONS
+/*
+ * Replacement global allocation functions, which count every allocation in
+ * the process, including those made by the implementation, except those of
+ * threads that called ResourceUsage::exclude(). The array and nothrow forms
+ * from libstdc++ call these.
+ */
+
+void*
+operator new(
+    std::size_t size)
+{
+	if (!ELFT::Validation::ResourceUsage::excludedThread) {
+		ELFT::Validation::ResourceUsage::allocations.fetch_add(1,
+		    std::memory_order_relaxed);
+		ELFT::Validation::ResourceUsage::allocatedBytes.fetch_add(
+		    static_cast<int64_t>(size), std::memory_order_relaxed);
+	}
+
+	for (;;) {
+		void *p = std::malloc(size == 0 ? 1 : size);
+		if (p != nullptr)
+			return (p);
+
+		const auto handler = std::get_new_handler();
+		if (handler == nullptr)
+			throw std::bad_alloc{};
+		handler();
+	}
+}
+
+void*
+operator new(
+    std::size_t size,
+    std::align_val_t alignment)
+{
+	if (!ELFT::Validation::ResourceUsage::excludedThread) {
+		ELFT::Validation::ResourceUsage::allocations.fetch_add(1,
+		    std::memory_order_relaxed);
+		ELFT::Validation::ResourceUsage::allocatedBytes.fetch_add(
+		    static_cast<int64_t>(size), std::memory_order_relaxed);
+	}
+
+	/* aligned_alloc() requires a multiple of the alignment */
+	const auto align = static_cast<std::size_t>(alignment);
+	const auto rounded = std::max(((size + align - 1) / align) * align,
+	    align);
+	for (;;) {
+		void *p = std::aligned_alloc(align, rounded);
+		if (p != nullptr)
+			return (p);
+
+		const auto handler = std::get_new_handler();
+		if (handler == nullptr)
+			throw std::bad_alloc{};
+		handler();
+	}
+}
+
+void
+operator delete(
+    void *p)
+    noexcept
+{
+	std::free(p);
+}
+
+void
+operator delete(
+    void *p,
+    std::align_val_t)
+    noexcept
+{
+	std::free(p);
+}
+
+void
+operator delete(
+    void *p,
+    std::size_t)
+    noexcept
+{
+	std::free(p);
+}
+
+void
+operator delete(
+    void *p,
+    std::size_t,
+    std::align_val_t)
+    noexcept
+{
+	std::free(p);
 }
+#endif /* ELFT_VALIDATION_COUNT_ALLOCATIONS */
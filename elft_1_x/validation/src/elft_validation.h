@@ -11,16 +11,36 @@
 #ifndef ELFT_VALIDATION_H_
 #define ELFT_VALIDATION_H_
 
+#include <sys/types.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include <elft.h>
 #include <elft_validation_data.h>
 
+/* Manifest read when --manifest is not provided (set by CMake) */
+#ifndef ELFT_VALIDATION_MANIFEST
+#define ELFT_VALIDATION_MANIFEST "elft_validation_data.manifest"
+#endif
+
 namespace ELFT::Validation
 {
 	/** Operations that this executable can perform. */
@@ -38,10 +58,20 @@ namespace ELFT::Validation
 		Identify,
 		/** Print identification provided by SearchInterface. */
 		IdentifySearch,
+		/** Convert a ColumnarLog to CSV. */
+		ConvertLog,
+		/** Measure search throughput across gallery sizes. */
+		Benchmark,
+		/** Compare logged API call times to their budgets. */
+		CheckBudgets,
 		/** Print usage. */
 		Usage
 	};
 
+	/** Images and EFS passed to ExtractionInterface::createTemplate(). */
+	using Samples = std::vector<std::tuple<std::optional<Image>,
+	    std::optional<EFS>>>;
+
 	/** Arguments passed on the command line */
 	struct Arguments
 	{
@@ -51,6 +81,8 @@ namespace ELFT::Validation
 		std::optional<Operation> operation{};
 		/** Number of processes to run. */
 		uint8_t numProcs{1};
+		/** Number of threads sharing one implementation instance. */
+		uint8_t numThreads{1};
 		/** Configuration directory. */
 		std::filesystem::path configDir{};
 		/** Enrollment database directory. */
@@ -61,10 +93,1653 @@ namespace ELFT::Validation
 		uint64_t maximum{};
 		/** Directory where output will be written. */
 		std::filesystem::path outputDir{"output"};
-		/** Directory containing images from ELFT::Validation::Data. */
+		/** Directory containing images listed in the Manifest. */
 		std::filesystem::path imageDir{"images"};
+		/** Manifest of the images and EFS to make into templates. */
+		std::filesystem::path manifestPath{ELFT_VALIDATION_MANIFEST};
+		/** Write ColumnarLog instead of CSV for API results. */
+		bool columnarLogs{false};
+		/** Log hardware performance counters around API calls. */
+		bool hardwareCounters{false};
+		/** Log CPU time, memory, and page faults around API calls. */
+		bool resourceUsage{false};
+		/** ColumnarLog to convert (Operation::ConvertLog only). */
+		std::filesystem::path logPath{};
+		/** Gallery sizes to search (Operation::Benchmark only). */
+		std::vector<uint64_t> gallerySizes{};
+		/** Untimed searches before timing each gallery size. */
+		uint64_t warmupSearches{10};
+		/** Timed searches of each gallery size. */
+		uint64_t benchmarkSearches{1000};
+		/** Timed insertions into each gallery size, after searches. */
+		uint64_t benchmarkInserts{0};
+		/** Benchmark SyntheticGallery, not reference templates. */
+		bool syntheticGallery{false};
+	};
+
+	/*
+	 * Time allowed for API calls by elft.h, in microseconds.
+	 */
+
+	/** ExtractionInterface::getImplementation(). */
+	constexpr uint64_t GetExtractionImplementationBudget{10'000'000};
+	/** Average ExtractionInterface::createTemplate(), per sample. */
+	constexpr uint64_t CreateTemplateBudgetPerSample{500};
+	/** ExtractionInterface::createReferenceDatabase(), per template. */
+	constexpr uint64_t CreateReferenceDatabaseBudgetPerTemplate{10};
+	/** SearchInterface::getImplementation(). */
+	constexpr uint64_t GetSearchImplementationBudget{5'000'000};
+	/**
+	 * Average SearchInterface::search(), per identifier in the reference
+	 * database.
+	 */
+	constexpr uint64_t SearchBudgetPerIdentifier{300};
+	/** SearchInterface::exists(), insert(), and remove(). */
+	constexpr uint64_t ModifyReferenceDatabaseBudget{5'000'000};
+
+	/** API call times compared to one budget (Operation::CheckBudgets). */
+	struct BudgetCompliance
+	{
+		/** API call, and how its budget is applied. */
+		std::string budget{};
+		/** Number of calls measured. */
+		uint64_t calls{};
+		/** Number of measurements over budget. */
+		uint64_t violations{};
+		/** Measurement with the least headroom, in microseconds. */
+		double measured{};
+		/** Budget of `measured`, in microseconds. */
+		double limit{};
+	};
+
+	/** Search throughput of one gallery size (Operation::Benchmark). */
+	struct BenchmarkResult
+	{
+		/** Number of templates in the reference database. */
+		uint64_t gallerySize{};
+		/** Time to create the reference database, in microseconds. */
+		int64_t createElapsed{};
+		/** Time to load the reference database, in microseconds. */
+		int64_t loadElapsed{};
+		/** Number of timed searches. */
+		uint64_t searches{};
+		/** Number of timed searches that did not return success. */
+		uint64_t failures{};
+		/** Timed searches completed per second. */
+		double searchesPerSecond{};
+		/** Mean search time, in microseconds. */
+		double mean{};
+		/** Median search time, in microseconds. */
+		int64_t p50{};
+		/** 90th percentile search time, in microseconds. */
+		int64_t p90{};
+		/** 99th percentile search time, in microseconds. */
+		int64_t p99{};
+		/** Longest search time, in microseconds. */
+		int64_t max{};
+		/** Number of timed insertions. */
+		uint64_t inserts{};
+		/** Number of timed insertions that did not return success. */
+		uint64_t insertFailures{};
+		/** Mean insertion time, in microseconds. */
+		double insertMean{};
+		/** Longest insertion time, in microseconds. */
+		int64_t insertMax{};
+	};
+
+	/**
+	 * @brief
+	 * Log file written asynchronously from a ring of buffers.
+	 *
+	 * @details
+	 * Appends only copy into the current buffer. Full buffers are
+	 * written by a background thread with large write() calls, so
+	 * logging between timed operations does not make syscalls. Appends
+	 * wait only if every buffer is waiting to be written.
+	 */
+	class LogSink
+	{
+	public:
+		/**
+		 * @brief
+		 * LogSink constructor, which starts the writer thread.
+		 *
+		 * @param path
+		 * Path to the log file, which is truncated.
+		 * @param numBuffers
+		 * Number of buffers in the ring.
+		 * @param bufferSize
+		 * Size of each buffer, in bytes.
+		 *
+		 * @throw runtime_error
+		 * Error creating the log file.
+		 */
+		LogSink(
+		    const std::filesystem::path &path,
+		    const std::size_t numBuffers = 4,
+		    const std::size_t bufferSize = 1024 * 1024);
+
+		/** Write remaining data, ignoring errors, and join. */
+		~LogSink();
+
+		LogSink(const LogSink&) = delete;
+		LogSink& operator=(const LogSink&) = delete;
+
+		/**
+		 * @brief
+		 * Append bytes to the log.
+		 *
+		 * @param data
+		 * Bytes to append.
+		 * @param size
+		 * Number of bytes in `data`.
+		 *
+		 * @throw runtime_error
+		 * An earlier write to the log failed.
+		 */
+		void
+		write(
+		    const void *data,
+		    std::size_t size);
+
+		/** @copydoc write() */
+		void
+		write(
+		    const std::string &data);
+
+		/**
+		 * @brief
+		 * Wait for all appended bytes to be written.
+		 *
+		 * @throw runtime_error
+		 * A write to the log failed.
+		 */
+		void
+		flush();
+
+		/** @return Path to the log file. */
+		const std::filesystem::path&
+		getPath()
+		    const
+		    noexcept;
+
+	private:
+		/**
+		 * @brief
+		 * Queue the current buffer for writing and obtain an empty
+		 * one.
+		 *
+		 * @throw runtime_error
+		 * A write to the log failed.
+		 */
+		void
+		submit();
+
+		/** Body of the writer thread. */
+		void
+		drain();
+
+		/** Path to the log file. */
+		const std::filesystem::path path;
+		/** Log file descriptor. */
+		int fd{-1};
+		/** Ring of buffers, each with capacity reserved. */
+		std::vector<std::vector<char>> buffers{};
+		/** Index of the buffer being appended to. */
+		std::size_t current{0};
+
+		/** Protects the members below. */
+		std::mutex mutex{};
+		/** Signaled when `started`, `pending` or `available` change. */
+		std::condition_variable changed{};
+		/** Indicies of full buffers, in the order to write them. */
+		std::deque<std::size_t> pending{};
+		/** Indicies of empty buffers. */
+		std::deque<std::size_t> available{};
+		/** Whether or not the writer thread has called exclude(). */
+		bool started{false};
+		/** Whether or not the writer thread has been asked to stop. */
+		bool stopping{false};
+		/** Description of a failed write, if any. */
+		std::string error{};
+
+		/** Writer thread, started once the buffers are reserved. */
+		std::thread writer{};
+	};
+
+	/**
+	 * @brief
+	 * Destination for rows of typed values.
+	 *
+	 * @details
+	 * Values are appended one column at a time, in the order of the
+	 * columns passed to the constructor. A row ends after its last column.
+	 */
+	class Log
+	{
+	public:
+		/** Types of values in a column. */
+		enum class Type : uint8_t
+		{
+			/** Signed integer. */
+			Integer = 1,
+			/** Floating point number. */
+			Real = 2,
+			/** String, logged verbatim. */
+			String = 3,
+			/** String, logged quoted by sanitizeMessage(). */
+			QuotedString = 4,
+			/** List of integer tuples, logged as by splice(). */
+			Tuples = 5
+		};
+
+		/** A single column of a Log. */
+		struct Column
+		{
+			/** Name of the column, as in a CSV header. */
+			std::string name{};
+			/** Type of values in the column. */
+			Type type{};
+			/** Number of integers in each tuple (Type::Tuples). */
+			uint8_t width{1};
+		};
+
+		/**
+		 * @brief
+		 * Log constructor.
+		 *
+		 * @param columns
+		 * Columns in each row.
+		 */
+		explicit Log(
+		    const std::vector<Column> &columns);
+
+		virtual ~Log();
+
+		/**
+		 * @brief
+		 * Write any buffered rows.
+		 *
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 * @throw logic_error
+		 * Called while a row is partially complete.
+		 */
+		virtual void
+		flush() = 0;
+
+		/** @return Columns in each row. */
+		const std::vector<Column>&
+		getColumns()
+		    const
+		    noexcept;
+
+		/**
+		 * @brief
+		 * Append the next value of the current row.
+		 *
+		 * @param value
+		 * Value to append.
+		 *
+		 * @return
+		 * Reference to this object.
+		 *
+		 * @throw logic_error
+		 * The next column is not of this type.
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 */
+		Log&
+		integer(
+		    const int64_t value);
+
+		/** @copydoc integer() */
+		Log&
+		real(
+		    const double value);
+
+		/** @copydoc integer() */
+		Log&
+		string(
+		    const std::string &value);
+
+		/** @copydoc integer() */
+		Log&
+		quoted(
+		    const std::string &value);
+
+		/** @copydoc integer() */
+		Log&
+		tuples(
+		    const std::vector<Coordinate> &value);
+
+		/** @copydoc integer() */
+		Log&
+		tuples(
+		    const std::vector<Minutia> &value);
+
+		/** @copydoc integer() */
+		template<typename T, typename = typename
+		    std::enable_if<std::is_integral<T>::value ||
+		    std::is_enum<T>::value>::type>
+		Log&
+		integer(
+		    const T value)
+		{
+			return (this->integer(static_cast<int64_t>(value)));
+		}
+
+		/**
+		 * @brief
+		 * Append the next value of the current row, or a missing
+		 * value if not populated.
+		 *
+		 * @param value
+		 * Optional integral or enumeration value to append.
+		 *
+		 * @return
+		 * Reference to this object.
+		 *
+		 * @throw logic_error
+		 * The next column is not of this type.
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 */
+		template<typename T>
+		Log&
+		integer(
+		    const std::optional<T> &value)
+		{
+			if (!value)
+				return (this->na());
+			return (this->integer(*value));
+		}
+
+		/** @copydoc integer() */
+		template<typename T, typename = typename
+		    std::enable_if<std::is_enum<T>::value>::type>
+		Log&
+		tuples(
+		    const std::vector<T> &value)
+		{
+			std::vector<int64_t> flattened{};
+			flattened.reserve(value.size());
+			for (const auto &e : value)
+				flattened.push_back(static_cast<int64_t>(e));
+			return (this->tuples(flattened, 1));
+		}
+
+		/** @copydoc integer(const std::optional<T>&) */
+		template<typename T>
+		Log&
+		tuples(
+		    const std::optional<std::vector<T>> &value)
+		{
+			if (!value)
+				return (this->na());
+			return (this->tuples(*value));
+		}
+
+		/**
+		 * @brief
+		 * Append the next value of the current row.
+		 *
+		 * @param values
+		 * Integers of all tuples, one tuple after the other.
+		 * @param width
+		 * Number of integers in each tuple.
+		 *
+		 * @return
+		 * Reference to this object.
+		 *
+		 * @throw logic_error
+		 * The next column is not tuples of `width`.
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 */
+		Log&
+		tuples(
+		    const std::vector<int64_t> &values,
+		    const uint8_t width);
+
+		/**
+		 * @brief
+		 * Append missing values for the next columns of the current
+		 * row.
+		 *
+		 * @param count
+		 * Number of columns without a value.
+		 *
+		 * @return
+		 * Reference to this object.
+		 *
+		 * @throw logic_error
+		 * Fewer than `count` columns remain in the current row.
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 */
+		Log&
+		na(
+		    const std::size_t count = 1);
+
+	protected:
+		/** @return Index of the column to be written next. */
+		std::size_t
+		getColumnIndex()
+		    const
+		    noexcept;
+
+		/** Write an integer for the current column. */
+		virtual void
+		writeInteger(
+		    const int64_t value) = 0;
+
+		/** Write a floating point number for the current column. */
+		virtual void
+		writeReal(
+		    const double value) = 0;
+
+		/** Write a String or QuotedString for the current column. */
+		virtual void
+		writeString(
+		    const std::string &value) = 0;
+
+		/** Write tuples for the current column. */
+		virtual void
+		writeTuples(
+		    const std::vector<int64_t> &values) = 0;
+
+		/** Write a missing value for the current column. */
+		virtual void
+		writeNA() = 0;
+
+		/** Finish the current row. */
+		virtual void
+		endRow() = 0;
+
+	private:
+		/**
+		 * @brief
+		 * Ensure the next column has the expected type.
+		 *
+		 * @param type
+		 * Expected type.
+		 *
+		 * @throw logic_error
+		 * The next column is not `type`.
+		 */
+		void
+		check(
+		    const Type type)
+		    const;
+
+		/** Move to the next column, ending the row if needed. */
+		void
+		advance();
+
+		/** Columns in each row. */
+		const std::vector<Column> columns;
+		/** Index of the column to be written next. */
+		std::size_t column{0};
+	};
+
+	/** Log written as comma-separated values. */
+	class CSVLog : public Log
+	{
+	public:
+		/**
+		 * @brief
+		 * CSVLog constructor, which writes the header.
+		 *
+		 * @param path
+		 * Path to the log file, which is truncated.
+		 * @param columns
+		 * Columns in each row.
+		 *
+		 * @throw runtime_error
+		 * Error creating or writing to the log.
+		 */
+		CSVLog(
+		    const std::filesystem::path &path,
+		    const std::vector<Column> &columns);
+
+		void
+		flush()
+		    override;
+
+	protected:
+		void
+		writeInteger(
+		    const int64_t value)
+		    override;
+
+		void
+		writeReal(
+		    const double value)
+		    override;
+
+		void
+		writeString(
+		    const std::string &value)
+		    override;
+
+		void
+		writeTuples(
+		    const std::vector<int64_t> &values)
+		    override;
+
+		void
+		writeNA()
+		    override;
+
+		void
+		endRow()
+		    override;
+
+	private:
+		/** Separate the next value from the previous in the row. */
+		void
+		separate();
+
+		/** Log file. */
+		LogSink file;
+		/** Current row. */
+		std::string row{};
 	};
 
+	/**
+	 * @brief
+	 * Log written as binary columns, for conversion to CSV later.
+	 *
+	 * @details
+	 * Rows are buffered into chunks. Each chunk holds a fixed-width
+	 * array of values for each column, then a heap with the bytes of
+	 * variable-length values, so no text is formatted while logging.
+	 * Use convertColumnarLog() to obtain the equivalent CSV.
+	 *
+	 * Layout, in host byte order:
+	 *  - "ELFTCOL\0", uint32_t version, uint32_t number of columns
+	 *  - Each column: uint8_t type, uint8_t width, uint16_t length of
+	 *    name, name
+	 *  - Each chunk: uint32_t rows, uint32_t heap size, then for each
+	 *    column a bitmap of rows with values and a uint64_t per row,
+	 *    then the heap
+	 *
+	 * For String, QuotedString, and Tuples, the low 32 bits of a value
+	 * are an offset into the heap and the high 32 bits are a length in
+	 * bytes. Tuples are int64_t.
+	 */
+	class ColumnarLog : public Log
+	{
+	public:
+		/** Identifies a ColumnarLog file. */
+		static constexpr char Magic[8]{'E', 'L', 'F', 'T', 'C', 'O',
+		    'L', '\0'};
+		/** Version of the layout. */
+		static constexpr uint32_t Version{1};
+		/** Rows buffered before writing a chunk. */
+		static constexpr uint32_t ChunkRows{4096};
+		/** Heap size after which a chunk is written early. */
+		static constexpr std::size_t ChunkHeapSize{64 * 1024 * 1024};
+
+		/**
+		 * @brief
+		 * ColumnarLog constructor, which writes the header.
+		 *
+		 * @param path
+		 * Path to the log file, which is truncated.
+		 * @param columns
+		 * Columns in each row.
+		 *
+		 * @throw runtime_error
+		 * Error creating or writing to the log.
+		 */
+		ColumnarLog(
+		    const std::filesystem::path &path,
+		    const std::vector<Column> &columns);
+
+		/** Write remaining rows, ignoring errors. */
+		~ColumnarLog()
+		    override;
+
+		void
+		flush()
+		    override;
+
+	protected:
+		void
+		writeInteger(
+		    const int64_t value)
+		    override;
+
+		void
+		writeReal(
+		    const double value)
+		    override;
+
+		void
+		writeString(
+		    const std::string &value)
+		    override;
+
+		void
+		writeTuples(
+		    const std::vector<int64_t> &values)
+		    override;
+
+		void
+		writeNA()
+		    override;
+
+		void
+		endRow()
+		    override;
+
+	private:
+		/** Write the current chunk, if it has any rows. */
+		void
+		writeChunk();
+
+		/**
+		 * @brief
+		 * Record a value for the current column and row.
+		 *
+		 * @param value
+		 * Fixed-width representation of the value.
+		 */
+		void
+		store(
+		    const uint64_t value);
+
+		/**
+		 * @brief
+		 * Copy bytes into the heap.
+		 *
+		 * @param data
+		 * Bytes to copy.
+		 * @param size
+		 * Number of bytes in `data`.
+		 *
+		 * @return
+		 * Heap offset and size of the copy, packed as a value.
+		 */
+		uint64_t
+		allocate(
+		    const void *data,
+		    const std::size_t size);
+
+		/** Log file. */
+		LogSink file;
+		/** Values of each column in the current chunk. */
+		std::vector<std::vector<uint64_t>> values{};
+		/** Number of complete rows in the current chunk. */
+		uint32_t rows{0};
+		/** Bitmaps of rows with values, for each column. */
+		std::vector<std::vector<uint8_t>> present{};
+		/** Variable-length values of the current chunk. */
+		std::vector<std::byte> heap{};
+	};
+
+	/** Read-only memory map of an entire file. */
+	class MappedFile
+	{
+	public:
+		/**
+		 * @brief
+		 * MappedFile constructor.
+		 *
+		 * @param pathName
+		 * Path to file to map.
+		 *
+		 * @throw runtime_error
+		 * Error opening or mapping file.
+		 */
+		explicit MappedFile(
+		    const std::string &pathName);
+
+		/** Unmap file. */
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		 * @return
+		 * Pointer to the first byte of the file, or nullptr if the
+		 * file is empty.
+		 */
+		const std::byte*
+		data()
+		    const
+		    noexcept;
+
+		/**
+		 * @return
+		 * Size of the file in bytes.
+		 */
+		std::size_t
+		size()
+		    const
+		    noexcept;
+
+	private:
+		/** Start of the mapping. */
+		void *address{nullptr};
+		/** Length of the mapping. */
+		std::size_t length{0};
+	};
+
+	/**
+	 * @brief
+	 * Validation dataset, read from a manifest file.
+	 *
+	 * @details
+	 * The manifest is mapped and indexed by the offset of each image
+	 * set's line, but an image set is not parsed until it is requested,
+	 * so datasets far larger than the validation images can be used
+	 * without rebuilding. The format is described at the top of
+	 * elft_validation_data.manifest.
+	 */
+	class Manifest
+	{
+	public:
+		/**
+		 * @brief
+		 * Manifest constructor, which indexes the image sets.
+		 *
+		 * @param path
+		 * Path to the manifest.
+		 *
+		 * @throw runtime_error
+		 * Error reading the manifest, or a line with an unknown set.
+		 */
+		explicit Manifest(
+		    const std::filesystem::path &path);
+
+		/**
+		 * @brief
+		 * Obtain the number of image sets of a type.
+		 *
+		 * @param templateType
+		 * Probe for latent image sets, Reference for reference
+		 * image sets.
+		 *
+		 * @return
+		 * Number of image sets of `templateType`.
+		 */
+		uint64_t
+		size(
+		    const TemplateType templateType)
+		    const;
+
+		/**
+		 * @brief
+		 * Obtain the identifier of an image set, without parsing
+		 * its images.
+		 *
+		 * @param templateType
+		 * Probe for latent image sets, Reference for reference
+		 * image sets.
+		 * @param index
+		 * Index of the image set of `templateType`.
+		 *
+		 * @return
+		 * Identifier of the image set.
+		 *
+		 * @throw out_of_range
+		 * `index` is not less than size(`templateType`).
+		 */
+		std::string
+		getIdentifier(
+		    const TemplateType templateType,
+		    const uint64_t index)
+		    const;
+
+		/**
+		 * @brief
+		 * Parse an image set.
+		 *
+		 * @param templateType
+		 * Probe for latent image sets, Reference for reference
+		 * image sets.
+		 * @param index
+		 * Index of the image set of `templateType`.
+		 *
+		 * @return
+		 * Identifier and images of the image set.
+		 *
+		 * @throw out_of_range
+		 * `index` is not less than size(`templateType`).
+		 * @throw runtime_error
+		 * Image set could not be parsed.
+		 */
+		Data::ImageSet
+		getImageSet(
+		    const TemplateType templateType,
+		    const uint64_t index)
+		    const;
+
+	private:
+		/**
+		 * @brief
+		 * Obtain the line of an image set.
+		 *
+		 * @param templateType
+		 * Probe for latent image sets, Reference for reference
+		 * image sets.
+		 * @param index
+		 * Index of the image set of `templateType`.
+		 *
+		 * @return
+		 * Line of the image set, without its newline.
+		 *
+		 * @throw out_of_range
+		 * `index` is not less than size(`templateType`).
+		 */
+		std::string_view
+		getLine(
+		    const TemplateType templateType,
+		    const uint64_t index)
+		    const;
+
+		/**
+		 * @brief
+		 * Parse one image of an image set.
+		 *
+		 * @param image
+		 * Space-separated key=value pairs describing the image.
+		 * @param identifier
+		 * Identifier of the image set, for error messages.
+		 *
+		 * @return
+		 * Metadata and EFS of the image.
+		 *
+		 * @throw runtime_error
+		 * Unknown key or invalid value.
+		 */
+		static Data::ImageMetadata
+		parseImage(
+		    const std::string_view image,
+		    const std::string &identifier);
+
+		/**
+		 * @brief
+		 * Parse an integral value.
+		 *
+		 * @param value
+		 * Decimal representation of the value.
+		 *
+		 * @return
+		 * `value` as type T.
+		 *
+		 * @throw invalid_argument
+		 * `value` is not a decimal integer representable as T.
+		 */
+		template<typename T>
+		static T
+		parseInteger(
+		    const std::string_view value);
+
+		/**
+		 * @brief
+		 * Split a string.
+		 *
+		 * @param s
+		 * String to split.
+		 * @param separator
+		 * Character separating the tokens of `s`.
+		 *
+		 * @return
+		 * Tokens of `s`, which is empty if `s` is empty.
+		 */
+		static std::vector<std::string_view>
+		split(
+		    const std::string_view s,
+		    const char separator);
+
+		/** Path to the manifest, for error messages. */
+		const std::filesystem::path path;
+		/** The manifest. */
+		const MappedFile file;
+		/** Offset of each latent image set's line. */
+		std::vector<uint64_t> latents{};
+		/** Offset of each reference image set's line. */
+		std::vector<uint64_t> references{};
+	};
+
+	/**
+	 * @brief
+	 * Indicies to be processed by the workers of a single run.
+	 *
+	 * @details
+	 * Workers claim batches of indicies by advancing a counter in shared
+	 * memory, so a worker that drew quick images is not left idle while
+	 * others work through a fixed slice. The queue must be constructed
+	 * before fork() to be shared with child processes.
+	 */
+	class WorkQueue
+	{
+	public:
+		/**
+		 * @brief
+		 * WorkQueue constructor.
+		 *
+		 * @param indicies
+		 * Indicies to be processed, in the order they should be
+		 * claimed.
+		 * @param numWorkers
+		 * Number of workers that will claim from the queue, used to
+		 * size batches.
+		 *
+		 * @throw runtime_error
+		 * Could not map shared memory.
+		 */
+		WorkQueue(
+		    const std::vector<uint64_t> &indicies,
+		    const uint8_t numWorkers);
+
+		/** Unmap shared memory. */
+		~WorkQueue();
+
+		WorkQueue(const WorkQueue&) = delete;
+		WorkQueue& operator=(const WorkQueue&) = delete;
+
+		/**
+		 * @brief
+		 * Claim the next batch of indicies.
+		 *
+		 * @return
+		 * Indicies not claimed by any other worker, or an empty
+		 * vector once all indicies have been claimed.
+		 *
+		 * @note
+		 * Batches shrink as the queue drains, so workers finish at
+		 * nearly the same time.
+		 */
+		std::vector<uint64_t>
+		next();
+
+	private:
+		/** All indicies to be processed. */
+		const std::vector<uint64_t> indicies;
+		/** Number of workers claiming from this queue. */
+		const uint64_t numWorkers;
+		/** Position of the next unclaimed index, in shared memory. */
+		std::atomic<uint64_t> *position{nullptr};
+	};
+
+	/**
+	 * @brief
+	 * Distribution of elapsed time of each timed API call in a run.
+	 *
+	 * @details
+	 * Elapsed times are counted in log-bucketed histograms with
+	 * 2^SubBucketBits linear sub-buckets per power of two, so reported
+	 * percentiles are within about 3% of the recorded times. The
+	 * identifiers of the slowest calls are kept as well. Histograms live
+	 * in shared memory, so the object must be constructed before fork()
+	 * for workers' calls to be merged.
+	 */
+	class Latencies
+	{
+	public:
+		/** API calls that are timed. */
+		enum class Call : uint8_t
+		{
+			CreateTemplate,
+			ExtractTemplateData,
+			CreateReferenceDatabase,
+			Search,
+			ExtractCorrespondence,
+			Exists,
+			Insert,
+			Remove,
+			GetExtractionImplementation,
+			GetSearchImplementation
+		};
+		/** Number of values in Call. */
+		static constexpr std::size_t NumCalls{10};
+
+		/** Number of slowest calls reported for each Call. */
+		static constexpr std::size_t NumSlowest{10};
+		/** Longest identifier kept for a slowest call. */
+		static constexpr std::size_t MaxIdentifierLength{63};
+
+		/**
+		 * @brief
+		 * Latencies constructor.
+		 *
+		 * @throw runtime_error
+		 * Could not map shared memory.
+		 */
+		Latencies();
+
+		/** Unmap shared memory. */
+		~Latencies();
+
+		Latencies(const Latencies&) = delete;
+		Latencies& operator=(const Latencies&) = delete;
+
+		/**
+		 * @brief
+		 * Record the elapsed time of a call.
+		 *
+		 * @param call
+		 * API call that was timed.
+		 * @param start
+		 * Time immediately before the call.
+		 * @param stop
+		 * Time immediately after the call.
+		 * @param identifier
+		 * Identifier to report if the call is among the slowest.
+		 */
+		void
+		record(
+		    const Call call,
+		    const std::chrono::steady_clock::time_point &start,
+		    const std::chrono::steady_clock::time_point &stop,
+		    const std::string &identifier);
+
+		/**
+		 * @brief
+		 * Write a summary of all recorded calls.
+		 *
+		 * @details
+		 * Each row holds percentiles of one Call, in microseconds,
+		 * followed by one of its slowest calls. Call only once all
+		 * workers have finished.
+		 *
+		 * @param path
+		 * Path to the summary log, which is truncated.
+		 *
+		 * @throw runtime_error
+		 * Error writing to the log.
+		 */
+		void
+		writeSummary(
+		    const std::filesystem::path &path)
+		    const;
+
+	private:
+		/** Base 2 log of the number of sub-buckets per power of 2. */
+		static constexpr uint8_t SubBucketBits{5};
+		/** Number of buckets needed to count any uint64_t. */
+		static constexpr std::size_t NumBuckets{
+		    (64 - SubBucketBits + 1) << SubBucketBits};
+
+		/** A call among the slowest. */
+		struct Slow
+		{
+			/** Elapsed time, in microseconds. */
+			uint64_t elapsed{};
+			/** NUL-terminated identifier of the call. */
+			char identifier[MaxIdentifierLength + 1]{};
+		};
+
+		/** Histogram for one Call, placed in shared memory. */
+		struct Histogram
+		{
+			/** Number of calls in each bucket. */
+			std::array<std::atomic<uint64_t>, NumBuckets> counts{};
+			/** Longest elapsed time. */
+			std::atomic<uint64_t> max{0};
+			/** Shortest elapsed time that may enter `slowest`. */
+			std::atomic<uint64_t> threshold{0};
+			/** Protects `numSlowest` and `slowest`. */
+			std::atomic_flag lock = ATOMIC_FLAG_INIT;
+			/** Number of entries of `slowest` in use. */
+			std::size_t numSlowest{0};
+			/** Slowest calls, in no particular order. */
+			std::array<Slow, NumSlowest> slowest{};
+		};
+
+		/**
+		 * @param value
+		 * Elapsed time.
+		 *
+		 * @return
+		 * Index of the bucket counting `value`.
+		 */
+		static std::size_t
+		getBucket(
+		    const uint64_t value)
+		    noexcept;
+
+		/**
+		 * @param bucket
+		 * Index of a bucket.
+		 *
+		 * @return
+		 * Largest value counted in `bucket`.
+		 */
+		static uint64_t
+		getBucketLimit(
+		    const std::size_t bucket)
+		    noexcept;
+
+		/** Histograms for each Call, in shared memory. */
+		Histogram *histograms{nullptr};
+	};
+
+	/**
+	 * @brief
+	 * Hardware performance counters of the calling thread.
+	 *
+	 * @details
+	 * Events are counted in user space by a perf_event_open(2) group, so
+	 * all counters are read with a single read(2). Events the CPU or
+	 * kernel cannot count, or all events when perf_event_open(2) is not
+	 * permitted, are logged as NA. Construct on the thread to be
+	 * measured.
+	 *
+	 * Threads started by the implementation (e.g., to search shards in
+	 * parallel) are not counted, so counts would miss most of the work
+	 * of a multithreaded implementation. Once the process has threads
+	 * other than the driver's own, every event is logged as NA.
+	 */
+	class HardwareCounters
+	{
+	public:
+		/** Counted events, in the order of their log columns. */
+		enum class Event : uint8_t
+		{
+			Cycles,
+			Instructions,
+			LLCMisses,
+			BranchMisses,
+			DTLBMisses
+		};
+		/** Number of values in Event. */
+		static constexpr std::size_t NumEvents{5};
+
+		/** Value of each Event, if counted. */
+		using Counts = std::array<std::optional<uint64_t>, NumEvents>;
+
+		/**
+		 * @brief
+		 * HardwareCounters constructor, which starts counting.
+		 *
+		 * @param enabled
+		 * Whether or not to count. When false, no counters are
+		 * opened and log() appends nothing.
+		 * @param driverThreads
+		 * Number of threads run by the driver, not counting those
+		 * that call ResourceUsage::exclude(). Any other thread was
+		 * started by the implementation.
+		 */
+		HardwareCounters(
+		    const bool enabled,
+		    const std::size_t driverThreads);
+
+		/** Stop counting. */
+		~HardwareCounters();
+
+		HardwareCounters(const HardwareCounters&) = delete;
+		HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+		/**
+		 * @brief
+		 * Read current values of all counters.
+		 *
+		 * @return
+		 * Current values, or std::nullopt for events not counted.
+		 */
+		Counts
+		read()
+		    const;
+
+		/**
+		 * @brief
+		 * Append the events counted between two reads to a row.
+		 *
+		 * @param log
+		 * Log with columns from addColumns().
+		 * @param before
+		 * Values read immediately before an API call.
+		 * @param after
+		 * Values read immediately after the API call.
+		 *
+		 * @note
+		 * Appends NA for every event if the implementation has
+		 * started threads.
+		 *
+		 * @throw logic_error
+		 * `log` does not have counter columns next.
+		 */
+		void
+		log(
+		    Log &log,
+		    const Counts &before,
+		    const Counts &after)
+		    const;
+
+		/**
+		 * @brief
+		 * Add a column for each Event after the elapsed column.
+		 *
+		 * @param columns
+		 * Columns of a log with an elapsed column.
+		 *
+		 * @return
+		 * `columns` with counter columns added.
+		 *
+		 * @throw logic_error
+		 * `columns` has no elapsed column.
+		 */
+		static std::vector<Log::Column>
+		addColumns(
+		    const std::vector<Log::Column> &columns);
+
+	private:
+		/**
+		 * @return
+		 * Whether or not the process has threads other than the
+		 * driver's.
+		 */
+		bool
+		hasImplementationThreads()
+		    const;
+
+		/** Whether or not counting was requested. */
+		const bool enabled;
+		/** Threads run by the driver, from the constructor. */
+		const std::size_t driverThreads;
+		/** File descriptor of the group leader, or -1. */
+		int leader{-1};
+		/** File descriptors of all counted events. */
+		std::vector<int> fds{};
+		/** Counted events, in the order a group read returns them. */
+		std::vector<Event> events{};
+	};
+
+	/**
+	 * @brief
+	 * CPU time, memory, and page faults of this process.
+	 *
+	 * @details
+	 * CPU time and page faults come from getrusage(2) and RSS from
+	 * /proc/self/statm, so they include threads started by the
+	 * implementation. CPU time and allocations of threads the driver
+	 * starts for its own work (SampleLoader, LogSink) are left out,
+	 * since they call exclude(). Page faults and RSS cannot be attributed
+	 * to a thread, so they still include those threads. When other
+	 * worker threads call the implementation concurrently (--threads),
+	 * no figure can be attributed to one call, and all are logged as NA.
+	 * Allocations are counted by replacement global operator new, which
+	 * is only compiled when ELFT_VALIDATION_COUNT_ALLOCATIONS is defined
+	 * (so the implementation's own allocator is not replaced by default);
+	 * otherwise they are logged as NA. malloc(3) is not counted.
+	 */
+	class ResourceUsage
+	{
+	public:
+		/** Values at one instant. Missing values are logged as NA. */
+		struct Counts
+		{
+			/** User plus system CPU time, in microseconds. */
+			std::optional<int64_t> cpuTime{};
+			/** Calls to operator new. */
+			std::optional<int64_t> allocations{};
+			/** Bytes requested from operator new. */
+			std::optional<int64_t> allocatedBytes{};
+			/** Resident set size, in bytes. */
+			std::optional<int64_t> rss{};
+			/** Largest resident set size so far, in bytes. */
+			std::optional<int64_t> peakRSS{};
+			/** Page faults serviced without I/O. */
+			std::optional<int64_t> minorFaults{};
+			/** Page faults that required I/O. */
+			std::optional<int64_t> majorFaults{};
+		};
+
+		/**
+		 * @brief
+		 * ResourceUsage constructor.
+		 *
+		 * @param enabled
+		 * Whether or not to read usage. When false, read() returns
+		 * empty Counts and log() appends nothing.
+		 * @param concurrent
+		 * Whether or not other worker threads call the implementation
+		 * at the same time. When true, read() returns empty Counts,
+		 * so log() appends NA.
+		 */
+		ResourceUsage(
+		    const bool enabled,
+		    const bool concurrent);
+
+		/** Close /proc/self/statm. */
+		~ResourceUsage();
+
+		ResourceUsage(const ResourceUsage&) = delete;
+		ResourceUsage& operator=(const ResourceUsage&) = delete;
+
+		/**
+		 * @brief
+		 * Read current usage.
+		 *
+		 * @return
+		 * Current values, with std::nullopt for values not read.
+		 */
+		Counts
+		read()
+		    const;
+
+		/**
+		 * @brief
+		 * Append usage between two reads to a row.
+		 *
+		 * @param log
+		 * Log with columns from addColumns().
+		 * @param before
+		 * Values read immediately before an API call.
+		 * @param after
+		 * Values read immediately after the API call.
+		 */
+		void
+		log(
+		    Log &log,
+		    const Counts &before,
+		    const Counts &after)
+		    const;
+
+		/**
+		 * @brief
+		 * Add usage columns after the elapsed column.
+		 *
+		 * @param columns
+		 * Columns of a log with an elapsed column.
+		 *
+		 * @return
+		 * `columns` with usage columns added.
+		 *
+		 * @throw logic_error
+		 * `columns` has no elapsed column.
+		 */
+		static std::vector<Log::Column>
+		addColumns(
+		    const std::vector<Log::Column> &columns);
+
+		/**
+		 * @brief
+		 * Exclude the CPU time and allocations of the calling thread
+		 * from read().
+		 *
+		 * @details
+		 * Called once at the start of threads the driver starts for
+		 * its own work. The thread's CPU time is excluded until it
+		 * exits, and afterward.
+		 */
+		static void
+		exclude();
+
+		/**
+		 * @return
+		 * Number of running threads that called exclude().
+		 */
+		static std::size_t
+		excludedThreads();
+
+		/** Calls to operator new, if counted. */
+		static std::atomic<int64_t> allocations;
+		/** Bytes requested from operator new, if counted. */
+		static std::atomic<int64_t> allocatedBytes;
+		/** Whether the calling thread's allocations are not counted. */
+		static thread_local bool excludedThread;
+
+	private:
+		/**
+		 * @return
+		 * CPU time of excluded threads, in microseconds.
+		 */
+		static int64_t
+		excludedCPUTime();
+
+		/** Whether or not reading was requested. */
+		const bool enabled;
+		/** Whether or not other threads call the implementation. */
+		const bool concurrent;
+		/** Open /proc/self/statm, or -1. */
+		int statm{-1};
+		/** Size of a page, in bytes. */
+		const int64_t pageSize;
+
+		/** Protects the excluded members below. */
+		static std::mutex excludedMutex;
+		/** CPU clocks of running excluded threads. */
+		static std::vector<clockid_t> excludedClocks;
+		/** CPU time of excluded threads that have exited, in us. */
+		static int64_t exitedCPUTime;
+	};
+
+	/**
+	 * @brief
+	 * Reference templates created from synthetic EFS.
+	 *
+	 * @details
+	 * Each index is a synthetic identity with a unique identifier, whose
+	 * EFS depend only on the seed and the index, so any part of a gallery
+	 * can be recreated without storing it. Identities mix rolled
+	 * ten-prints, plain slaps, palms, and partial sets of fingers, with
+	 * minutia counts drawn around typical values for each region, so
+	 * template sizes vary as they would for real captures.
+	 */
+	class SyntheticGallery
+	{
+	public:
+		/**
+		 * @brief
+		 * SyntheticGallery constructor.
+		 *
+		 * @param impl
+		 * Pointer to ELFT API implementation for extraction.
+		 * @param seed
+		 * Seed from which every identity is derived.
+		 */
+		SyntheticGallery(
+		    std::shared_ptr<ExtractionInterface> impl,
+		    const uint64_t seed);
+
+		/**
+		 * @brief
+		 * Obtain the identifier of a synthetic identity.
+		 *
+		 * @param index
+		 * Index of the identity.
+		 *
+		 * @return
+		 * Identifier unique to `index`, distinct from those in the
+		 * Manifest.
+		 */
+		static std::string
+		getIdentifier(
+		    const uint64_t index);
+
+		/**
+		 * @brief
+		 * Obtain the synthetic EFS of an identity.
+		 *
+		 * @param index
+		 * Index of the identity.
+		 *
+		 * @return
+		 * Samples (EFS only) to pass to
+		 * ExtractionInterface::createTemplate().
+		 */
+		Samples
+		getSamples(
+		    const uint64_t index)
+		    const;
+
+		/**
+		 * @brief
+		 * Create the reference template of an identity.
+		 *
+		 * @param index
+		 * Index of the identity.
+		 *
+		 * @return
+		 * Reference template for getIdentifier(`index`).
+		 *
+		 * @throw runtime_error
+		 * Implementation did not create the template.
+		 */
+		std::vector<std::byte>
+		createTemplate(
+		    const uint64_t index)
+		    const;
+
+	private:
+		/** Implementation creating templates. */
+		const std::shared_ptr<ExtractionInterface> impl;
+		/** Seed from which every identity is derived. */
+		const uint64_t seed;
+	};
+
+	/**
+	 * @brief
+	 * Loads samples for one worker ahead of when they are needed.
+	 *
+	 * @details
+	 * A loader thread claims indicies from a WorkQueue and reads their
+	 * samples into a bounded buffer while the worker creates templates
+	 * from samples loaded earlier. The kernel is asked to begin reading
+	 * the images of upcoming samples before the loader gets to them.
+	 */
+	class SampleLoader
+	{
+	public:
+		/** Samples loaded for a single index. */
+		struct Entry
+		{
+			/** Index of an image set in the Manifest. */
+			uint64_t index{};
+			/** Samples for `index`. */
+			Samples samples{};
+		};
+
+		/**
+		 * @brief
+		 * SampleLoader constructor, which starts the loader thread.
+		 *
+		 * @param queue
+		 * Queue from which to claim indicies.
+		 * @param args
+		 * Arguments parsed from command line.
+		 * @param depth
+		 * Maximum number of loaded entries waiting to be consumed.
+		 */
+		SampleLoader(
+		    WorkQueue &queue,
+		    const Arguments &args,
+		    const std::size_t depth = 4);
+
+		/** Stop and join the loader thread. */
+		~SampleLoader();
+
+		SampleLoader(const SampleLoader&) = delete;
+		SampleLoader& operator=(const SampleLoader&) = delete;
+
+		/**
+		 * @brief
+		 * Obtain the next loaded entry, waiting for it if needed.
+		 *
+		 * @return
+		 * Next entry, or std::nullopt once `queue` is exhausted.
+		 *
+		 * @throw
+		 * Error encountered by the loader thread, once the entries
+		 * it loaded before the error have been consumed.
+		 */
+		std::optional<Entry>
+		next();
+
+	private:
+		/** Body of the loader thread. */
+		void
+		load();
+
+		/**
+		 * @brief
+		 * Advise the kernel that the images for an index will be
+		 * needed soon.
+		 *
+		 * @param imageIndex
+		 * Index of an image set in the Manifest.
+		 */
+		void
+		advise(
+		    const uint64_t imageIndex)
+		    const;
+
+		/** Queue from which to claim indicies. */
+		WorkQueue &queue;
+		/** Arguments parsed from command line. */
+		const Arguments &args;
+		/** Maximum number of entries in `loaded`. */
+		const std::size_t depth;
+
+		/** Protects the members below. */
+		std::mutex mutex{};
+		/** Signaled when `loaded` or the loader state changes. */
+		std::condition_variable changed{};
+		/** Entries loaded but not yet consumed. */
+		std::deque<Entry> loaded{};
+		/** Whether or not the loader thread has finished loading. */
+		bool finished{false};
+		/** Whether or not the loader thread has been asked to stop. */
+		bool stopping{false};
+		/** Error encountered by the loader thread. */
+		std::exception_ptr error{};
+
+		/** Loader thread. Declared last so it starts last. */
+		std::thread loader{};
+	};
+
+	/**
+	 * @brief
+	 * Convert a ColumnarLog to CSV.
+	 *
+	 * @param path
+	 * Path to the ColumnarLog.
+	 *
+	 * @return
+	 * Path to the CSV log, which is `path` with the extension ".log".
+	 *
+	 * @throw runtime_error
+	 * `path` is not a valid ColumnarLog, or error writing the CSV log.
+	 */
+	std::filesystem::path
+	convertColumnarLog(
+	    const std::filesystem::path &path);
+
+	/**
+	 * @brief
+	 * Compare the API call times logged in an output directory to the
+	 * budgets in elft.h, and print a report.
+	 *
+	 * @details
+	 * Averaged budgets (createTemplate(), search()) are compared to the
+	 * mean of all calls. All other budgets apply to every call; calls
+	 * only logged in a latency summary are represented by the slowest.
+	 * The search() budget uses the size of the reference database when
+	 * it was created, since the logs don't record whether searches ran
+	 * before or after modifications. Logs written with --columnar-logs
+	 * must first be converted to CSV.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 *
+	 * @return
+	 * EXIT_SUCCESS if every budget was met. EXIT_FAILURE otherwise.
+	 *
+	 * @throw runtime_error
+	 * No timings logged in the output directory, or error reading a log.
+	 */
+	int
+	checkBudgets(
+	    const Arguments &args);
+
 	/**
 	 * @brief
 	 * Call the appropriate starting method based on the operation argument
@@ -82,23 +1757,61 @@ namespace ELFT::Validation
 
 	/**
 	 * @brief
-	 * Return an element from the appropriate Data::Validation vector.
+	 * Return an image set from the Manifest.
 	 *
+	 * @param args
+	 * Arguments parsed from command line.
 	 * @param imageIndex
-	 * Element index in the ImageSet vector.
+	 * Index of the image set of `templateType`.
 	 * @param templateType
-	 * The type of template we want, which will let us switch to the
-	 * appropriate ImageSet vector.
+	 * The type of template we want, which will let us switch to latent
+	 * or reference image sets.
 	 *
 	 * @return
-	 * Reference to the entry `imageIndex` from the appropriate Data::
-	 * Validation vector based on `templateType`.
+	 * Image set `imageIndex` of `templateType`.
 	 */
-	const Data::ImageSet&
+	Data::ImageSet
 	getImageSet(
+	    const Arguments &args,
 	    const uint64_t imageIndex,
 	    const TemplateType templateType);
 
+	/**
+	 * @brief
+	 * Obtain the Manifest, reading it on first use.
+	 *
+	 * @param args
+	 * Arguments parsed from command line. Only the manifestPath of the
+	 * first call is read.
+	 *
+	 * @return
+	 * Manifest at args.manifestPath.
+	 *
+	 * @throw runtime_error
+	 * Error reading the manifest.
+	 */
+	const Manifest&
+	getManifest(
+	    const Arguments &args);
+
+	/**
+	 * @brief
+	 * Obtain the implementation's ExtractionInterface, recording how long
+	 * it took.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 * @param latencies
+	 * Where the elapsed time of getImplementation() is recorded.
+	 *
+	 * @return
+	 * ExtractionInterface::getImplementation() for `args`.
+	 */
+	std::shared_ptr<ExtractionInterface>
+	getExtractionImplementation(
+	    const Arguments &args,
+	    Latencies &latencies);
+
 	/**
 	 * @brief
 	 * Format identification information about an ELFT implementation's
@@ -116,6 +1829,24 @@ namespace ELFT::Validation
 	getExtractionInterfaceIdentificationString(
 	    const Arguments &args);
 
+	/**
+	 * @brief
+	 * Obtain the implementation's SearchInterface, recording how long it
+	 * took.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 * @param latencies
+	 * Where the elapsed time of getImplementation() is recorded.
+	 *
+	 * @return
+	 * SearchInterface::getImplementation() for `args`.
+	 */
+	std::shared_ptr<SearchInterface>
+	getSearchImplementation(
+	    const Arguments &args,
+	    Latencies &latencies);
+
 	/**
 	 * @brief
 	 * Format identification information about an ELFT implementation's
@@ -147,6 +1878,77 @@ namespace ELFT::Validation
 	getUsageString(
 	    const std::string &name = "");
 
+	/**
+	 * @brief
+	 * Obtain a name for a worker that is unique within this run, for use
+	 * in log file names and messages.
+	 *
+	 * @param pid
+	 * ID of the worker's process.
+	 * @param thread
+	 * Index of the worker thread within `pid`, when running multiple
+	 * threads (--threads).
+	 *
+	 * @return
+	 * `pid`, followed by `thread` if populated.
+	 */
+	std::string
+	getWorkerName(
+	    const pid_t pid,
+	    const std::optional<uint8_t> thread = {});
+
+	/**
+	 * @brief
+	 * Merge the logs written by each worker into a single log, ordered by
+	 * identifier.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 * @param prefix
+	 * Name of the log, before the worker name.
+	 * @param workerNames
+	 * Names of each worker that wrote a log, from getWorkerName().
+	 * @param identifiers
+	 * Log identifiers (first field of each line), in the order in which
+	 * they should appear in the merged log. Lines with the same identifier
+	 * stay in the order their worker wrote them.
+	 *
+	 * @throw runtime_error
+	 * Error reading a worker's log or writing the merged log.
+	 *
+	 * @note
+	 * Each worker's log is removed once merged.
+	 */
+	void
+	mergeLogs(
+	    const Arguments &args,
+	    const std::string &prefix,
+	    const std::vector<std::string> &workerNames,
+	    const std::vector<std::string> &identifiers);
+
+	/**
+	 * @brief
+	 * Create the log for results of an API call.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 * @param name
+	 * Name of the log, without extension.
+	 * @param columns
+	 * Columns in each row.
+	 *
+	 * @return
+	 * ColumnarLog if requested in `args`, otherwise CSVLog.
+	 *
+	 * @throw runtime_error
+	 * Error creating the log.
+	 */
+	std::unique_ptr<Log>
+	openLog(
+	    const Arguments &args,
+	    const std::string &name,
+	    const std::vector<Log::Column> &columns);
+
 	/**
 	 * @brief
 	 * Create a template from one or more images.
@@ -155,20 +1957,32 @@ namespace ELFT::Validation
 	 * Pointer to ELFT extraction implementation.
 	 * @param imageIndex
 	 * Element index in the ImageSet vector.
+	 * @param samples
+	 * Samples for `imageIndex`, from readSamples().
 	 * @param args
 	 * Arguments parsed from command line.
-	 *
-	 * @return
-	 * Entry for log file.
+	 * @param log
+	 * Log to which a row is appended for the template.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
+	 * @param counters
+	 * Hardware counters read around each API call.
+	 * @param usage
+	 * Resource usage read around each API call.
 	 *
 	 * @throw
-	 * Error reading image or creating template.
+	 * Error creating template.
 	 */
-	std::string
+	void
 	performSingleCreate(
 	    const std::shared_ptr<ExtractionInterface> impl,
 	    const uint64_t imageIndex,
-	    const Arguments &args);
+	    const Samples &samples,
+	    const Arguments &args,
+	    Log &log,
+	    Latencies &latencies,
+	    const HardwareCounters &counters,
+	    const ResourceUsage &usage);
 
 	/**
 	 * @brief
@@ -181,18 +1995,27 @@ namespace ELFT::Validation
 	 * createTemplate().
 	 * @param p
 	 * Path to the template on disk.
-	 *
-	 * @return
-	 * Entries for log file.
+	 * @param log
+	 * Log to which a row is appended for each TemplateData.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
+	 * @param counters
+	 * Hardware counters read around each API call.
+	 * @param usage
+	 * Resource usage read around each API call.
 	 *
 	 * @throw
 	 * Error reading image or creating template.
 	 */
-	std::string
+	void
 	performSingleExtractData(
 	    const std::shared_ptr<ExtractionInterface> impl,
 	    TemplateType templateType,
-	    const std::filesystem::path &p);
+	    const std::filesystem::path &p,
+	    Log &log,
+	    Latencies &latencies,
+	    const HardwareCounters &counters,
+	    const ResourceUsage &usage);
 
 	/**
 	 * @brief
@@ -207,17 +2030,28 @@ namespace ELFT::Validation
 	 * database.
 	 * @param maxCandidates
 	 * Maximum number of candidates to place in returned candidate list.
+	 * @param log
+	 * Log to which a row is appended for each candidate.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
+	 * @param counters
+	 * Hardware counters read around each API call.
+	 * @param usage
+	 * Resource usage read around each API call.
 	 *
 	 * @return
-	 * A tuple containing the SearchResult and a string with entries for
-	 * the candidates log file.
+	 * The SearchResult, with its candidate list sorted.
 	 */
-	std::tuple<ELFT::SearchResult, std::string>
+	ELFT::SearchResult
 	performSingleSearch(
 	    const std::shared_ptr<SearchInterface> impl,
 	    const std::string &identifier,
 	    const std::vector<std::byte> &probeTemplate,
-	    const uint16_t maxCandidates);
+	    const uint16_t maxCandidates,
+	    Log &log,
+	    Latencies &latencies,
+	    const HardwareCounters &counters,
+	    const ResourceUsage &usage);
 
 	/**
 	 * @brief
@@ -233,16 +2067,25 @@ namespace ELFT::Validation
 	 * @param searchResult
 	 * SearchResult returned from SearchInterface::search for
 	 * `probeTemplate` with the currently loaded reference database.
-	 *
-	 * @return
-	 * Entries for log file.
+	 * @param log
+	 * Log to which a row is appended for each Correspondence.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
+	 * @param counters
+	 * Hardware counters read around each API call.
+	 * @param usage
+	 * Resource usage read around each API call.
 	 */
-	std::string
+	void
 	performSingleSearchExtract(
 	    const std::shared_ptr<SearchInterface> impl,
 	    const std::string &identifier,
 	    const std::vector<std::byte> &probeTemplate,
-	    const SearchResult &searchResult);
+	    const SearchResult &searchResult,
+	    Log &log,
+	    Latencies &latencies,
+	    const HardwareCounters &counters,
+	    const ResourceUsage &usage);
 
 	/**
 	 * @brief
@@ -290,17 +2133,123 @@ namespace ELFT::Validation
 	 *
 	 * @throw runtime_error
 	 * Error reading from file.
+	 *
+	 * @note
+	 * The file is read directly into the result. Pass the result as an
+	 * rvalue (e.g., to Image's constructor) to avoid a copy.
 	 */
 	std::vector<std::byte>
 	readFile(
 	    const std::string &pathName);
 
+	/**
+	 * @brief
+	 * Read the images and EFS for one ImageSet.
+	 *
+	 * @param imageIndex
+	 * Element index in the ImageSet vector.
+	 * @param args
+	 * Arguments parsed from command line.
+	 *
+	 * @return
+	 * Samples to pass to ExtractionInterface::createTemplate().
+	 *
+	 * @throw runtime_error
+	 * Missing metadata or error reading an image.
+	 */
+	Samples
+	readSamples(
+	    const uint64_t imageIndex,
+	    const Arguments &args);
+
+	/**
+	 * @brief
+	 * Read all templates in a directory.
+	 *
+	 * @param dir
+	 * Directory of templates written by Operation::Extract.
+	 *
+	 * @return
+	 * Contents of each non-empty template, ordered by filename. Empty
+	 * files, written when template creation failed, are skipped.
+	 *
+	 * @throw runtime_error
+	 * Error reading a template.
+	 */
+	std::vector<std::vector<std::byte>>
+	readTemplates(
+	    const std::filesystem::path &dir);
+
+	/**
+	 * @brief
+	 * Measure search throughput and latency across gallery sizes.
+	 *
+	 * @details
+	 * For each gallery size, a reference database is created from
+	 * randomly chosen reference templates, or from a SyntheticGallery,
+	 * and loaded once. After untimed warmup searches, probe templates are
+	 * searched in turn, with nothing else (correspondence, logging)
+	 * between searches. Synthetic templates are then inserted one at a
+	 * time, if requested. Results are written to benchmark.log, and a
+	 * least-squares fit of mean search time against gallery size to
+	 * benchmarkFit.log.
+	 *
+	 * @param args
+	 * Arguments parsed from command line.
+	 *
+	 * @return
+	 * EXIT_SUCCESS if the mean search time of every gallery size is
+	 * within SearchBudgetPerIdentifier. EXIT_FAILURE otherwise.
+	 *
+	 * @throw
+	 * Missing templates, or error creating or searching a reference
+	 * database.
+	 */
+	int
+	runBenchmark(
+	    const Arguments &args);
+
+	/**
+	 * @brief
+	 * Measure search throughput and latency of one gallery size.
+	 *
+	 * @param impl
+	 * Pointer to ELFT API implementation for extraction.
+	 * @param references
+	 * Reference templates, the first `gallerySize` of which are placed
+	 * in the reference database.
+	 * @param probes
+	 * Probe templates to search, in turn.
+	 * @param gallerySize
+	 * Number of templates in the reference database.
+	 * @param synthetic
+	 * Source of templates to insert after searching.
+	 * @param args
+	 * Arguments parsed from command line.
+	 *
+	 * @return
+	 * Throughput and latency of searching `gallerySize` templates.
+	 *
+	 * @throw
+	 * Error creating or loading the reference database.
+	 */
+	BenchmarkResult
+	runBenchmarkGallery(
+	    std::shared_ptr<ExtractionInterface> impl,
+	    const std::vector<std::vector<std::byte>> &references,
+	    const std::vector<std::vector<std::byte>> &probes,
+	    const uint64_t gallerySize,
+	    const SyntheticGallery &synthetic,
+	    const Arguments &args);
+
 	/**
 	 * @brief
 	 * Have implementation create reference database on disk.
 	 *
 	 * @param impl
 	 * Pointer to ELFT API implementation for extraction.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
 	 * @param args
 	 * Arguments parsed from command line.
 	 *
@@ -310,6 +2259,7 @@ namespace ELFT::Validation
 	int
 	runCreateReferenceDatabase(
 	    std::shared_ptr<ExtractionInterface> impl,
+	    Latencies &latencies,
 	    const Arguments &args);
 
 	/**
@@ -318,17 +2268,26 @@ namespace ELFT::Validation
 	 *
 	 * @param impl
 	 * Pointer to ELFT API implementation for extraction.
-	 * @param indicies
-	 * The indicies from Data::Latents or Data::References from which to
+	 * @param queue
+	 * Queue of indicies of image sets in the Manifest from which to
 	 * create templates.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
 	 * @param args
 	 * Arguments parsed from command line.
+	 * @param workerName
+	 * Name of this worker, from getWorkerName().
+	 *
+	 * @return
+	 * The indicies claimed from `queue` by this worker.
 	 */
-	void
+	std::vector<uint64_t>
 	runExtractionCreate(
 	    std::shared_ptr<ExtractionInterface> impl,
-	    const std::vector<uint64_t> &indicies,
-	    const Arguments &args);
+	    WorkQueue &queue,
+	    Latencies &latencies,
+	    const Arguments &args,
+	    const std::string &workerName);
 
 	/**
 	 * @brief
@@ -338,16 +2297,22 @@ namespace ELFT::Validation
 	 * @param impl
 	 * Pointer to ELFT API implementation for extraction.
 	 * @param indicies
-	 * The indicies from Data::Latents or Data::References from which to
-	 * create templates.
+	 * The indicies of image sets in the Manifest from which to create
+	 * templates.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
 	 * @param args
 	 * Arguments parsed from command line.
+	 * @param workerName
+	 * Name of this worker, from getWorkerName().
 	 */
 	void
 	runExtractionExtractData(
 	    std::shared_ptr<ExtractionInterface> impl,
 	    const std::vector<uint64_t> &indicies,
-	    const Arguments &args);
+	    Latencies &latencies,
+	    const Arguments &args,
+	    const std::string &workerName);
 
 	/**
 	 * @brief
@@ -355,12 +2320,15 @@ namespace ELFT::Validation
 	 *
 	 * @param impl
 	 * Pointer to ELFT API implementation for search.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
 	 * @param args
 	 * Arguments parsed from command line.
 	 */
 	void
 	runModifyReferenceDatabase(
 	    std::shared_ptr<SearchInterface> impl,
+	    Latencies &latencies,
 	    const Arguments &args);
 
 	/**
@@ -369,17 +2337,51 @@ namespace ELFT::Validation
 	 *
 	 * @param impl
 	 * Pointer to ELFT API implementation for searching.
-	 * @param indicies
-	 * The indicies from Data::Latents whose corresponding templates should
-	 * be searched.
+	 * @param queue
+	 * Queue of indicies of latent image sets in the Manifest whose
+	 * corresponding templates should be searched.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
 	 * @param args
 	 * Arguments parsed from command line.
+	 * @param workerName
+	 * Name of this worker, from getWorkerName().
 	 */
 	void
 	runSearch(
 	    std::shared_ptr<SearchInterface> impl,
-	    const std::vector<uint64_t> &indicies,
-	    const Arguments &args);
+	    WorkQueue &queue,
+	    Latencies &latencies,
+	    const Arguments &args,
+	    const std::string &workerName);
+
+	/**
+	 * @brief
+	 * Run all API calls for the operation in `args` on indicies claimed
+	 * from a queue.
+	 *
+	 * @param impl
+	 * Pointer to the ELFT API implementation for the operation.
+	 * @param queue
+	 * Queue of indicies of image sets in the Manifest to process.
+	 * @param latencies
+	 * Where the elapsed time of each API call is recorded.
+	 * @param args
+	 * Arguments parsed from command line.
+	 * @param workerName
+	 * Name of this worker, from getWorkerName().
+	 *
+	 * @throw
+	 * Error running the operation, or unsupported operation.
+	 */
+	void
+	runWorker(
+	    const std::variant<std::shared_ptr<ExtractionInterface>,
+	    std::shared_ptr<SearchInterface>> &impl,
+	    WorkQueue &queue,
+	    Latencies &latencies,
+	    const Arguments &args,
+	    const std::string &workerName);
 
 	/**
 	 * @brief
@@ -404,24 +2406,17 @@ namespace ELFT::Validation
 
 	/**
 	 * @brief
-	 * Create multiple smaller sets from a large set.
+	 * Split a row of a CSVLog into its values.
 	 *
-	 * @param combinedSet
-	 * Set of numbers to split.
-	 * @param numSets
-	 * Number of sets to create.
+	 * @param line
+	 * Row written by CSVLog.
 	 *
 	 * @return
-	 * Collection of numSets collections, created sequentially
-	 * from combinedSet.
-	 *
-	 * @throw
-	 * numSets > combinedSet.size()
+	 * Values of `line`, with quoted strings unquoted and unescaped.
 	 */
-	std::vector<std::vector<uint64_t>>
-	splitSet(
-	    const std::vector<uint64_t> &combinedSet,
-	    const uint8_t numSets);
+	std::vector<std::string>
+	splitCSVLine(
+	    const std::string &line);
 
 	/**
 	 * @brief
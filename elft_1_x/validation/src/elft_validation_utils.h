@@ -121,7 +121,8 @@ namespace ELFT
 			std::string ret{};
 			for (const auto &c : v)
 				ret += ts(c.x) + ';' + ts(c.y) + sep;
-			ret.erase(ret.find_last_of(sep), sep.length());
+			if (!v.empty())
+				ret.erase(ret.length() - sep.length());
 			return (ret);
 		}
 
@@ -147,7 +148,8 @@ namespace ELFT
 				ret += ts(m.coordinate.x) + ';' +
 				    ts(m.coordinate.y) + ';' + ts(m.theta) +
 				    ';' + e2i2s(m.type) + sep;
-			ret.erase(ret.find_last_of(sep), sep.length());
+			if (!v.empty())
+				ret.erase(ret.length() - sep.length());
 			return (ret);
 		}
 
@@ -171,7 +173,8 @@ namespace ELFT
 			std::string ret{};
 			for (const auto &s : v)
 				ret += s + sep;
-			ret.erase(ret.find_last_of(sep), sep.length());
+			if (!v.empty())
+				ret.erase(ret.length() - sep.length());
 			return (ret);
 		}
 
@@ -197,10 +200,32 @@ namespace ELFT
 			std::string ret{};
 			for (const auto &e : v)
 				ret += e2i2s(e) + sep;
-			ret.erase(ret.find_last_of(sep), sep.length());
+			if (!v.empty())
+				ret.erase(ret.length() - sep.length());
 			return (ret);
 		}
 
+		/**
+		 * @brief
+		 * Obtain the difference of two times.
+		 *
+		 * @param start
+		 * Start time.
+		 * @param stop
+		 * Stop time.
+		 *
+		 * @return
+		 * end - start, in microseconds.
+		 */
+		std::chrono::microseconds::rep
+		microseconds(
+		    const std::chrono::steady_clock::time_point &start,
+		    const std::chrono::steady_clock::time_point &stop)
+		{
+			return (std::chrono::duration_cast<
+			    std::chrono::microseconds>(stop - start).count());
+		}
+
 		/**
 		 * @brief
 		 * Make a log-able string of the difference of two times.
@@ -218,8 +243,7 @@ namespace ELFT
 		    const std::chrono::steady_clock::time_point &start,
 		    const std::chrono::steady_clock::time_point &stop)
 		{
-			return (ts(std::chrono::duration_cast<
-			    std::chrono::microseconds>(stop - start).count()));
+			return (ts(microseconds(start, stop)));
 		}
 	}
 }